@@ -0,0 +1,176 @@
+// ============================================================
+//  Pico Drum bank image check
+//  Validates a bank image built by wav_converter.py (.bin, or the .uf2
+//  for the boot drive) with the firmware's own bankImageOpen(), lists the
+//  kit, then decodes every level and checks each seek checkpoint against
+//  the sequential decoder state.
+//
+//  Build: see README (Bank image).
+//    bank_check IMAGE
+// ============================================================
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adpcm.h"
+#include "bank_image.h"
+
+// Whole file, or nullptr
+static uint8_t *readFile(const char *path, uint32_t &size)
+{
+  FILE *in = fopen(path, "rb");
+  if (in == nullptr)
+  {
+    return nullptr;
+  }
+  fseek(in, 0, SEEK_END);
+  size = (uint32_t)ftell(in);
+  fseek(in, 0, SEEK_SET);
+  uint8_t *buf = (uint8_t *)malloc(size ? size : 1);
+  if (fread(buf, 1, size, in) != size)
+  {
+    free(buf);
+    buf = nullptr;
+  }
+  fclose(in);
+  return buf;
+}
+
+static uint32_t le32(const uint8_t *p)
+{
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// UF2 blocks → the flash contents they write, which must be contiguous
+static uint8_t *unpackUf2(const uint8_t *uf2, uint32_t size, uint32_t &len,
+                          uint32_t &address)
+{
+  const uint32_t BLOCK = 512;
+  uint32_t blocks = size / BLOCK;
+  if (blocks == 0)
+  {
+    return nullptr;
+  }
+  address = le32(uf2 + 12);
+  uint8_t *image = (uint8_t *)malloc(blocks * 256);
+  len = 0;
+  for (uint32_t i = 0; i < blocks; i++)
+  {
+    const uint8_t *b = uf2 + i * BLOCK;
+    if (le32(b) != 0x0A324655 || le32(b + 4) != 0x9E5D5157 ||
+        le32(b + 508) != 0x0AB16F30)
+    {
+      fprintf(stderr, "uf2 block %u: bad magic\n", (unsigned)i);
+      free(image);
+      return nullptr;
+    }
+    if ((le32(b + 8) & 0x2000) == 0 || le32(b + 28) != 0xE48BFF56)
+    {
+      fprintf(stderr, "uf2 block %u: not for the RP2040\n", (unsigned)i);
+      free(image);
+      return nullptr;
+    }
+    uint32_t at = le32(b + 12), n = le32(b + 16);
+    if (at != address + len || n > 256)
+    {
+      fprintf(stderr, "uf2 block %u: not contiguous\n", (unsigned)i);
+      free(image);
+      return nullptr;
+    }
+    memcpy(image + len, b + 32, n);
+    len += n;
+  }
+  return image;
+}
+
+// Decode a level front to back; the state at every checkpoint must be the
+// stored one. Returns the number of mismatches.
+static int checkLevel(const SampleBank &bank, const SampleLevel &l)
+{
+  const AdpcmState *cps = bank.checkpoints + l.checkpoint;
+  AdpcmDecoder d;
+  adpcmStart(d, bank.data + l.offset, cps);
+  int bad = 0;
+  for (uint32_t i = 0; i < l.length; i++)
+  {
+    if (i % ADPCM_CHECKPOINT == 0)
+    {
+      const AdpcmState &c = cps[i / ADPCM_CHECKPOINT];
+      if (c.predictor != d.predictor || c.index != d.index)
+      {
+        bad++;
+      }
+    }
+    adpcmAdvance(d, i + 1);
+  }
+  return bad;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc != 2)
+  {
+    fprintf(stderr, "usage: %s IMAGE.bin|IMAGE.uf2\n", argv[0]);
+    return 2;
+  }
+  uint32_t size = 0;
+  uint8_t *file = readFile(argv[1], size);
+  if (file == nullptr)
+  {
+    fprintf(stderr, "cannot read %s\n", argv[1]);
+    return 2;
+  }
+
+  uint8_t *image = file;
+  if (size >= 4 && le32(file) == 0x0A324655)
+  {
+    uint32_t address = 0;
+    image = unpackUf2(file, size, size, address);
+    if (image == nullptr)
+    {
+      return 1;
+    }
+    printf("uf2: %u bytes at 0x%08X\n", (unsigned)size, (unsigned)address);
+    if (address % BANK_IMAGE_SECTOR != 0)
+    {
+      printf("warning: not on a flash sector boundary\n");
+    }
+  }
+
+  SampleBank bank;
+  BankImageStatus status = bankImageOpen(image, size, bank);
+  if (status != BANK_IMAGE_OK)
+  {
+    printf("%s: %s\n", argv[1], bankImageStatusName(status));
+    return 1;
+  }
+
+  BankImageHeader h;
+  memcpy(&h, image, sizeof(h));
+  printf("%s: %u samples, %u bytes (%u ADPCM, %u checkpoints), crc %08X\n",
+         argv[1], (unsigned)h.count, (unsigned)h.size, (unsigned)h.dataSize,
+         (unsigned)h.checkpointCount, (unsigned)h.crc);
+
+  int bad = 0;
+  for (uint32_t i = 0; i < bank.count; i++)
+  {
+    const SampleInfo &s = bank.samples[i];
+    char name[BANK_IMAGE_NAME + 1] = {};
+    memcpy(name, image + h.nameOffset + i * BANK_IMAGE_NAME, BANK_IMAGE_NAME);
+    printf("%3u %-16s %6u Hz gain %5u  levels", (unsigned)i, name,
+           (unsigned)s.rootRate, (unsigned)s.gain);
+    int sampleBad = 0;
+    for (uint32_t k = 0; k < s.levels; k++)
+    {
+      printf(" %u", (unsigned)s.level[k].length);
+      sampleBad += checkLevel(bank, s.level[k]);
+    }
+    printf(sampleBad ? "  %d bad checkpoints\n" : "\n", sampleBad);
+    bad += sampleBad;
+  }
+
+  printf(bad ? "FAIL\n" : "ok\n");
+  return bad ? 1 : 0;
+}
@@ -0,0 +1,783 @@
+// ============================================================
+//  Pico Drum host benchmark
+//  Plays the compiled-in sample through the drum_core voice on Linux and
+//  compares it with the float playback it replaced, times the ADPCM
+//  decoder and its checkpoint seeks, and measures aliasing over a pitch
+//  sweep with and without the mipmap levels.
+//
+//  Build: see README (Host benchmark).
+// ============================================================
+
+#include <chrono>
+#include <math.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "audio.h"
+#include "pool.h"
+#include "sample_data.h"
+
+// First bank slot, level 0 decoded to 16-bit PCM for the references
+static const SampleLevel &PCM_LEVEL = sampleInfo[0].level[0];
+static const uint32_t PCM_LEN = PCM_LEVEL.length;
+static int16_t *pcm;
+
+// The same slot without its mipmap levels: plain interpolation at any pitch
+static SampleInfo singleInfo;
+static SampleBank singleBank;
+
+static void decodeSample()
+{
+  pcm = (int16_t *)malloc(PCM_LEN * sizeof(int16_t));
+  AdpcmDecoder d;
+  adpcmStart(d, sampleBank.data + PCM_LEVEL.offset,
+             sampleBank.checkpoints + PCM_LEVEL.checkpoint);
+  for (uint32_t i = 0; i < PCM_LEN; i++)
+  {
+    adpcmAdvance(d, i + 1);
+    pcm[i] = d.hist[3];
+  }
+
+  singleInfo = sampleInfo[0];
+  singleInfo.levels = 1;
+  singleBank = sampleBank;
+  singleBank.samples = &singleInfo;
+  singleBank.count = 1;
+}
+
+static uint64_t nowNs()
+{
+  using namespace std::chrono;
+  return (uint64_t)duration_cast<nanoseconds>(
+             steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// ── Float voice (the previous onTimer() math) ───────────────
+struct FloatVoice
+{
+  bool playing;
+  float volume;
+  float decay;
+  float pos;
+  float pitch;
+};
+
+static int16_t floatNext(FloatVoice &v)
+{
+  if (!v.playing)
+  {
+    return 0;
+  }
+  int idx = (int)v.pos;
+  if (idx >= (int)PCM_LEN)
+  {
+    v.playing = false;
+    return 0;
+  }
+  float frac = v.pos - idx;
+  int16_t s0 = pcm[idx];
+  int16_t s1 = (idx + 1 < (int)PCM_LEN) ? pcm[idx + 1] : 0;
+  float sample = s0 + frac * (s1 - s0);
+  sample *= v.volume;
+  if (sample > 32767.0f) sample = 32767.0f;
+  if (sample < -32768.0f) sample = -32768.0f;
+  v.volume *= v.decay;
+  v.pos += v.pitch;
+  return (int16_t)sample;
+}
+
+// ── Exact reference ─────────────────────────────────────────
+// The same playback in double precision, with the fixed-point voice's
+// (quantised) step and decay: what the integer path should produce.
+static void referenceRender(double *out, int n, uint32_t step, uint32_t decay)
+{
+  double pos = 0.0;
+  double gain = 1.0;
+  double inc = step / 65536.0;
+  double d = decay / 2147483648.0;
+  for (int i = 0; i < n; i++)
+  {
+    int idx = (int)pos;
+    if (idx >= (int)PCM_LEN)
+    {
+      out[i] = 0.0;
+      continue;
+    }
+    double frac = pos - idx;
+    double s0 = pcm[idx];
+    double s1 = (idx + 1 < (int)PCM_LEN) ? pcm[idx + 1] : 0;
+    out[i] = (s0 + frac * (s1 - s0)) * gain;
+    gain *= d;
+    pos += inc;
+  }
+}
+
+// Whole sample at the slowest pitch, plus a little silence
+static const int RENDER_LEN = PCM_LEN * 2 + 64;
+
+// Returns false when the fixed-point voice is more than 1 LSB off the
+// exact rendering anywhere.
+static bool comparePlayback(int rawPitch, int rawDecay)
+{
+  static int16_t *fixedOut = (int16_t *)malloc(RENDER_LEN * sizeof(int16_t));
+  static int16_t *floatOut = (int16_t *)malloc(RENDER_LEN * sizeof(int16_t));
+  static double *refOut = (double *)malloc(RENDER_LEN * sizeof(double));
+
+  Voice v;
+  voiceStart(v, singleBank, 0);
+  v.step = voicePitchStep(rawPitch);
+  v.decay = voiceDecay(rawDecay);
+  uint64_t t0 = nowNs();
+  for (int i = 0; i < RENDER_LEN; i += AUDIO_BLOCK)
+  {
+    int n = (RENDER_LEN - i < AUDIO_BLOCK) ? RENDER_LEN - i : AUDIO_BLOCK;
+    voiceRender(v, fixedOut + i, n);
+  }
+  uint64_t fixedNs = nowNs() - t0;
+
+  // Same step and decay as the fixed-point voice, so the comparison is of
+  // the arithmetic, not of the pot mapping
+  FloatVoice fv = {true, 1.0f, (float)(v.decay / 2147483648.0), 0.0f,
+                   (float)(v.step / 65536.0)};
+  for (int i = 0; i < RENDER_LEN; i++)
+  {
+    floatOut[i] = floatNext(fv);
+  }
+
+  referenceRender(refOut, RENDER_LEN, v.step, v.decay);
+
+  double errRef = 0.0;
+  int errFloat = 0;
+  for (int i = 0; i < RENDER_LEN; i++)
+  {
+    errRef = fmax(errRef, fabs(fixedOut[i] - round(refOut[i])));
+    errFloat = abs(fixedOut[i] - floatOut[i]) > errFloat
+                   ? abs(fixedOut[i] - floatOut[i])
+                   : errFloat;
+  }
+
+  bool ok = errRef <= 1.0;
+  printf("%5d %5d %8.2f %9d %9.2f%s\n", rawPitch, rawDecay, errRef, errFloat,
+         (double)fixedNs / RENDER_LEN, ok ? "" : "  FAIL");
+  return ok;
+}
+
+// ── Polyphony ───────────────────────────────────────────────
+// Host render time with 1 … VOICE_COUNT voices playing at once (no decay,
+// so none of them drops out): at unity pitch (one level), at 1.5x
+// (crossfading two levels), and at 1.5x with Hermite interpolation. This
+// only shows how the cost scales with voices and options; the ISR's
+// headroom on the RP2040 comes from AUDIO_STATS_SERIAL (cycles per sample
+// against the budget, with the number of active voices).
+static double renderNs(int voices, uint32_t step, bool hermite)
+{
+  static int16_t out[AUDIO_BLOCK];
+  const int blocks = 44100 / AUDIO_BLOCK / 4; // 250 ms of audio, in blocks
+
+  VoicePool pool;
+  poolInit(pool, 44100000);
+  pool.step = step;
+  pool.hermite = hermite;
+  uint64_t ns = 0;
+  for (int b = 0; b < blocks; b++)
+  {
+    // Keep the voices busy, restarting the one that ends
+    while (poolActive(pool) < voices)
+    {
+      poolTrigger(pool, sampleBank, 0);
+    }
+    uint64_t t0 = nowNs();
+    poolRender(pool, out, AUDIO_BLOCK);
+    ns += nowNs() - t0;
+  }
+  return (double)ns / (blocks * AUDIO_BLOCK);
+}
+
+static void benchVoices()
+{
+  printf("\nvoices  1.0x ns/s  1.5x ns/s  1.5x hermite (host)\n");
+  for (int n = 1; n <= VOICE_COUNT; n++)
+  {
+    double unity = renderNs(n, VOICE_UNITY_STEP, false);
+    double mip = renderNs(n, VOICE_UNITY_STEP * 3 / 2, false);
+    double hermite = renderNs(n, VOICE_UNITY_STEP * 3 / 2, true);
+    printf("%6d %10.2f %10.2f %13.2f\n", n, unity, mip, hermite);
+  }
+}
+
+// ── ADPCM ───────────────────────────────────────────────────
+// Sequential decode cost, and random seeks checked against it: every jump
+// through a checkpoint must land on exactly the sequentially decoded
+// samples, after at most ADPCM_CHECKPOINT + 1 nibbles.
+static volatile int32_t adpcmSink;
+
+static void benchAdpcm()
+{
+  const uint8_t *data = sampleBank.data + PCM_LEVEL.offset;
+  const AdpcmState *cps = sampleBank.checkpoints + PCM_LEVEL.checkpoint;
+  const int runs = 50;
+
+  AdpcmDecoder d;
+  int32_t sum = 0;
+  uint64_t t0 = nowNs();
+  for (int r = 0; r < runs; r++)
+  {
+    adpcmStart(d, data, cps);
+    for (uint32_t i = 0; i < PCM_LEN; i++)
+    {
+      adpcmAdvance(d, i + 1);
+      sum += d.hist[3];
+    }
+  }
+  double seqNs = (double)(nowNs() - t0) / (runs * PCM_LEN);
+  adpcmSink = sum; // keep the decode loop
+
+  const int seeks = 100000;
+  uint32_t lcg = 1;
+  int bad = 0;
+  adpcmStart(d, data, cps);
+  t0 = nowNs();
+  for (int i = 0; i < seeks; i++)
+  {
+    lcg = lcg * 1664525u + 1013904223u;
+    uint32_t end = 1 + (lcg >> 8) % PCM_LEN; // 1 … PCM_LEN
+    adpcmAdvance(d, end);
+    for (uint32_t k = 0; k < 4; k++)
+    {
+      int32_t want = (end + k >= 4) ? pcm[end + k - 4] : 0;
+      if (d.hist[k] != want)
+      {
+        bad++;
+        break;
+      }
+    }
+  }
+  double seekNs = (double)(nowNs() - t0) / seeks;
+
+  printf("\nadpcm: %u samples in %u bytes, %.2f ns/sample sequential, "
+         "%.1f ns/seek, %d bad seeks\n",
+         (unsigned)PCM_LEN, (unsigned)((PCM_LEN + 1) / 2), seqNs, seekNs, bad);
+}
+
+// ── Aliasing ────────────────────────────────────────────────
+// Test tones are ADPCM-encoded here, each with a half-rate second level
+// from a windowed-sinc low-pass, and played through a voice over a sweep
+// of pitch settings: with level 0 only, with the mipmap crossfade, and
+// with the crossfade and Hermite interpolation. Aliasing is the output
+// energy at the frequencies a tone folds or images to when resampled from
+// either level (not the broadband ADPCM noise around them), summed over
+// the tones, in dB below the source.
+static const int ALIAS_FFT = 4096;
+static const int ALIAS_SKIP = 512;        // output samples before the window
+static const uint32_t ALIAS_LEN = 20000; // 2x pitch reads 2 * (SKIP + FFT)
+static const double aliasTones[] = {2500, 6000, 11000, 15000, 18500}; // Hz
+
+static uint8_t aliasData[(ALIAS_LEN + ALIAS_LEN / 2) / 2 + 2];
+static AdpcmState aliasCheckpoints[ALIAS_LEN / ADPCM_CHECKPOINT + 8];
+static SampleInfo aliasInfo;
+static double aliasRef; // source energy in the analysis window
+
+// Best nibble for every sample, chosen by running the library's decoder:
+// the stream decodes exactly as the voice will read it.
+static void encodeLevel(const double *x, uint32_t len, uint32_t &bytes,
+                        uint32_t &cps, SampleLevel &level)
+{
+  level.offset = bytes;
+  level.length = len;
+  level.checkpoint = cps;
+  uint8_t *data = aliasData + bytes;
+  memset(data, 0, (len + 1) / 2);
+
+  AdpcmDecoder d;
+  adpcmStart(d, data, aliasCheckpoints + cps);
+  for (uint32_t i = 0; i < len; i++)
+  {
+    if (i % ADPCM_CHECKPOINT == 0)
+    {
+      aliasCheckpoints[cps].predictor = (int16_t)d.predictor;
+      aliasCheckpoints[cps].index = (uint8_t)d.index;
+      cps++;
+    }
+    int32_t target = (int32_t)lround(x[i] * 32767.0);
+    int best = 0;
+    int32_t bestErr = INT32_MAX;
+    for (int nibble = 0; nibble < 16; nibble++)
+    {
+      data[i >> 1] = (uint8_t)((data[i >> 1] & ~(0x0F << ((i & 1) * 4))) |
+                               (nibble << ((i & 1) * 4)));
+      AdpcmDecoder t = d;
+      adpcmAdvance(t, i + 1);
+      int32_t err = abs(t.hist[3] - target);
+      if (err < bestErr)
+      {
+        bestErr = err;
+        best = nibble;
+      }
+    }
+    data[i >> 1] = (uint8_t)((data[i >> 1] & ~(0x0F << ((i & 1) * 4))) |
+                             (best << ((i & 1) * 4)));
+    adpcmAdvance(d, i + 1);
+  }
+  bytes += (len + 1) / 2;
+}
+
+// In-place radix-2 FFT
+static void fft(double *re, double *im, int n)
+{
+  for (int i = 1, j = 0; i < n; i++)
+  {
+    int bit = n >> 1;
+    for (; j & bit; bit >>= 1)
+    {
+      j ^= bit;
+    }
+    j ^= bit;
+    if (i < j)
+    {
+      double t = re[i];
+      re[i] = re[j];
+      re[j] = t;
+      t = im[i];
+      im[i] = im[j];
+      im[j] = t;
+    }
+  }
+  for (int len = 2; len <= n; len <<= 1)
+  {
+    double a = -2.0 * M_PI / len;
+    for (int i = 0; i < n; i += len)
+    {
+      for (int k = 0; k < len / 2; k++)
+      {
+        double wr = cos(a * k), wi = sin(a * k);
+        int u = i + k, v = i + k + len / 2;
+        double xr = re[v] * wr - im[v] * wi;
+        double xi = re[v] * wi + im[v] * wr;
+        re[v] = re[u] - xr;
+        im[v] = im[u] - xi;
+        re[u] += xr;
+        im[u] += xi;
+      }
+    }
+  }
+}
+
+// Power spectrum (bins 0 … ALIAS_FFT / 2) under a 4-term Blackman-Harris
+// window, whose sidelobes (-92 dB) stay below anything measured here
+static void spectrum(const double *x, double *power)
+{
+  static double re[ALIAS_FFT], im[ALIAS_FFT];
+  for (int i = 0; i < ALIAS_FFT; i++)
+  {
+    double p = 2.0 * M_PI * i / ALIAS_FFT;
+    double w = 0.35875 - 0.48829 * cos(p) + 0.14128 * cos(2 * p) -
+               0.01168 * cos(3 * p);
+    re[i] = x[i] * w;
+    im[i] = 0.0;
+  }
+  fft(re, im, ALIAS_FFT);
+  for (int i = 0; i <= ALIAS_FFT / 2; i++)
+  {
+    power[i] = re[i] * re[i] + im[i] * im[i];
+  }
+}
+
+static void buildAliasBank(double tone)
+{
+  static double level0[ALIAS_LEN], level1[ALIAS_LEN / 2];
+  for (uint32_t i = 0; i < ALIAS_LEN; i++)
+  {
+    level0[i] = 0.5 * sin(2.0 * M_PI * tone * i / 44100.0);
+  }
+
+  // Low-pass at 0.23 fs (129-tap Blackman-windowed sinc), keep every other
+  const int M = 64;
+  const double fc = 0.23;
+  for (uint32_t n = 0; n < ALIAS_LEN / 2; n++)
+  {
+    double s = 0.0;
+    for (int k = -M; k <= M; k++)
+    {
+      int i = (int)(2 * n) - k;
+      if (i < 0 || i >= (int)ALIAS_LEN)
+      {
+        continue;
+      }
+      double h = (k == 0) ? 2.0 * fc : sin(2.0 * M_PI * fc * k) / (M_PI * k);
+      double w = 0.42 + 0.5 * cos(M_PI * k / M) + 0.08 * cos(2 * M_PI * k / M);
+      s += h * w * level0[i];
+    }
+    level1[n] = s;
+  }
+
+  uint32_t bytes = 0, cps = 0;
+  encodeLevel(level0, ALIAS_LEN, bytes, cps, aliasInfo.level[0]);
+  encodeLevel(level1, ALIAS_LEN / 2, bytes, cps, aliasInfo.level[1]);
+  aliasInfo.levels = 2;
+  aliasInfo.rootRate = 44100;
+  aliasInfo.gain = BANK_UNITY_GAIN;
+
+  static double power[ALIAS_FFT / 2 + 1];
+  spectrum(level0, power);
+  aliasRef = 0.0;
+  for (double p : power)
+  {
+    aliasRef += p;
+  }
+}
+
+// Output energy where `tone` aliases to at `step`
+static double aliasEnergy(double tone, uint32_t levels, bool hermite,
+                          uint32_t step)
+{
+  static int16_t out[ALIAS_SKIP + ALIAS_FFT];
+  static double x[ALIAS_FFT];
+  static double power[ALIAS_FFT / 2 + 1];
+
+  SampleInfo info = aliasInfo;
+  info.levels = levels;
+  SampleBank bank = {aliasData, aliasCheckpoints, &info, 1};
+  Voice v;
+  voiceStart(v, bank, 0);
+  v.hermite = hermite;
+  v.step = step;
+  v.decay = VOICE_UNITY_GAIN;
+  for (int i = 0; i < ALIAS_SKIP + ALIAS_FFT; i += AUDIO_BLOCK)
+  {
+    voiceRender(v, out + i, AUDIO_BLOCK);
+  }
+  for (int i = 0; i < ALIAS_FFT; i++)
+  {
+    x[i] = out[ALIAS_SKIP + i] / 32767.0;
+  }
+  spectrum(x, power);
+
+  // Images of the tone around every multiple of the level-1 rate, scaled
+  // by the pitch and folded into 0 … Nyquist; ±5 bins for the window's
+  // main lobe. The tone itself is not aliasing while below Nyquist.
+  const int guard = 5;
+  const double fs = 44100.0;
+  const double bin = fs / ALIAS_FFT;
+  const double ratio = (double)step / VOICE_UNITY_STEP;
+  static bool mark[ALIAS_FFT / 2 + 1];
+  memset(mark, 0, sizeof(mark));
+  for (int k = -8; k <= 8; k++)
+  {
+    double g = fabs(fmod(ratio * (tone + k * fs / 2), fs));
+    g = (g > fs / 2) ? fs - g : g;
+    int c = (int)lround(g / bin);
+    for (int i = c - guard; i <= c + guard; i++)
+    {
+      if (i >= 0 && i <= ALIAS_FFT / 2)
+      {
+        mark[i] = true;
+      }
+    }
+  }
+  double real = ratio * tone;
+  if (real < fs / 2)
+  {
+    int c = (int)lround(real / bin);
+    for (int i = c - guard; i <= c + guard; i++)
+    {
+      if (i >= 0 && i <= ALIAS_FFT / 2)
+      {
+        mark[i] = false;
+      }
+    }
+  }
+
+  double alias = 0.0;
+  for (int i = 0; i <= ALIAS_FFT / 2; i++)
+  {
+    alias += mark[i] ? power[i] : 0.0;
+  }
+  return alias;
+}
+
+static void benchAliasing()
+{
+  const int pots[] = {0, 1365, 1706, 2047, 2389, 2730, 3071, 3413, 3754, 4095};
+  const int POTS = sizeof(pots) / sizeof(pots[0]);
+  double alias[POTS][3] = {};
+  double ref = 0.0;
+  for (double tone : aliasTones)
+  {
+    buildAliasBank(tone);
+    ref += aliasRef;
+    for (int p = 0; p < POTS; p++)
+    {
+      uint32_t step = voicePitchStep(pots[p]);
+      alias[p][0] += aliasEnergy(tone, 1, false, step);
+      alias[p][1] += aliasEnergy(tone, 2, false, step);
+      alias[p][2] += aliasEnergy(tone, 2, true, step);
+    }
+  }
+
+  // -99.9: nothing left where the tones would fold to
+  printf("\npitch  aliasing dB: level 0  mipmap  mipmap+hermite\n");
+  for (int p = 0; p < POTS; p++)
+  {
+    double db[3];
+    for (int m = 0; m < 3; m++)
+    {
+      db[m] = fmax(-99.9, 10.0 * log10(alias[p][m] / ref + 1e-30));
+    }
+    printf("%5.3f %21.1f %7.1f %15.1f\n",
+           (double)voicePitchStep(pots[p]) / VOICE_UNITY_STEP, db[0], db[1],
+           db[2]);
+  }
+}
+
+// ── ADPCM SNR ───────────────────────────────────────────────
+// Synthetic tones and noise, peak-normalised like wav_converter.py and
+// encoded by encodeLevel() (the converter's nearest-nibble search; the
+// --converter check below holds them to each other), decoded sequentially
+// and compared with the 16-bit source. The 8-bit column is the same source
+// in the unsigned 8-bit PCM the kit used before ADPCM: ADPCM only wins on
+// low-frequency material such as kicks, and loses 10-25 dB on high tones
+// and noise (the bundled 909_oh is at 13.5 dB). The thresholds keep it
+// from getting worse.
+struct SnrSource
+{
+  const char *name;
+  double freq;  // Hz, 0 for noise
+  double decay; // per second, for an envelope like a hit's
+  double minDb; // fail below this
+};
+
+static const SnrSource snrSources[] = {
+    {"sine 100 Hz", 100, 0, 53},     {"sine 1 kHz", 1000, 0, 31},
+    {"sine 5 kHz", 5000, 0, 22},     {"sine 12 kHz", 12000, 0, 19},
+    {"kick 60 Hz", 60, 8, 53},       {"white noise", 0, 0, 14},
+    {"noise hit", 0, 20, 13},
+};
+static const int SNR_SOURCES = sizeof(snrSources) / sizeof(snrSources[0]);
+
+static double snrX[ALIAS_LEN];
+static int16_t snrSrc[ALIAS_LEN], snrDec[ALIAS_LEN];
+
+// Every source in turn into snrX (peak-normalised) and snrSrc (its 16-bit
+// PCM); the noise draws from lcg, so they have to come in order.
+static void snrSource(const SnrSource &s, uint32_t &lcg)
+{
+  double peak = 0.0;
+  for (uint32_t i = 0; i < ALIAS_LEN; i++)
+  {
+    double t = i / 44100.0;
+    lcg = lcg * 1664525u + 1013904223u;
+    double v = (s.freq > 0) ? sin(2.0 * M_PI * s.freq * t)
+                            : (lcg >> 8) / 8388608.0 - 1.0;
+    snrX[i] = v * exp(-s.decay * t);
+    peak = fmax(peak, fabs(snrX[i]));
+  }
+  for (uint32_t i = 0; i < ALIAS_LEN; i++)
+  {
+    snrX[i] /= peak;
+    snrSrc[i] = (int16_t)lround(snrX[i] * 32767.0);
+  }
+}
+
+// encodeLevel() of the current source, decoded into snrDec
+static void snrEncode()
+{
+  uint32_t bytes = 0, cps = 0;
+  SampleLevel level;
+  encodeLevel(snrX, ALIAS_LEN, bytes, cps, level);
+  AdpcmDecoder d;
+  adpcmStart(d, aliasData, aliasCheckpoints);
+  for (uint32_t i = 0; i < ALIAS_LEN; i++)
+  {
+    adpcmAdvance(d, i + 1);
+    snrDec[i] = d.hist[3];
+  }
+}
+
+static double snrDb(const int16_t *src, const int16_t *dec, uint32_t len)
+{
+  double signal = 0.0, noise = 0.0;
+  for (uint32_t i = 0; i < len; i++)
+  {
+    double e = (double)src[i] - dec[i];
+    signal += (double)src[i] * src[i];
+    noise += e * e;
+  }
+  return (noise > 0.0) ? 10.0 * log10(signal / noise) : 99.9;
+}
+
+static bool benchSnr()
+{
+  static int16_t pcm8[ALIAS_LEN];
+  uint32_t lcg = 1;
+  bool ok = true;
+
+  printf("\nsource        adpcm dB  8-bit dB  min dB\n");
+  for (const SnrSource &s : snrSources)
+  {
+    snrSource(s, lcg);
+    for (uint32_t i = 0; i < ALIAS_LEN; i++)
+    {
+      pcm8[i] = (int16_t)((((snrSrc[i] + 32768) >> 8) - 128) << 8);
+    }
+    snrEncode();
+
+    double db = snrDb(snrSrc, snrDec, ALIAS_LEN);
+    bool pass = db >= s.minDb;
+    ok = ok && pass;
+    printf("%-13s %8.1f %9.1f %7.0f%s\n", s.name, db,
+           snrDb(snrSrc, pcm8, ALIAS_LEN), s.minDb, pass ? "" : "  FAIL");
+  }
+  return ok;
+}
+
+// ── Converter check ─────────────────────────────────────────
+// host/converter_check.py runs wav_converter.py on the same sources:
+// `--snr-sources DIR` writes them to DIR/snrN.raw (16-bit PCM), the script
+// leaves what the converter made of each in DIR/snrN.ima, and `--converter
+// DIR` decodes those with adpcmAdvance(). The firmware's decode must match
+// the converter's own decoded samples bit for bit, meet the thresholds
+// above, and be within a dB of encodeLevel().
+//
+//   snrN.ima: uint32 samples, uint32 checkpoints, AdpcmState[checkpoints],
+//             ADPCM bytes, int16 decoded[samples], little-endian
+
+static int writeSnrSources(const char *dir)
+{
+  uint32_t lcg = 1;
+  char path[512];
+  for (int k = 0; k < SNR_SOURCES; k++)
+  {
+    snrSource(snrSources[k], lcg);
+    snprintf(path, sizeof(path), "%s/snr%d.raw", dir, k);
+    FILE *out = fopen(path, "wb");
+    if (out == nullptr ||
+        fwrite(snrSrc, sizeof(int16_t), ALIAS_LEN, out) != ALIAS_LEN)
+    {
+      fprintf(stderr, "cannot write %s\n", path);
+      return 1;
+    }
+    fclose(out);
+  }
+  return 0;
+}
+
+static int checkConverter(const char *dir)
+{
+  static uint8_t file[8 + sizeof(aliasCheckpoints) + sizeof(aliasData) +
+                      sizeof(snrDec)];
+  uint32_t lcg = 1;
+  bool ok = true;
+
+  printf("source        conv dB  bench dB  min dB  mismatches\n");
+  for (int k = 0; k < SNR_SOURCES; k++)
+  {
+    const SnrSource &s = snrSources[k];
+    snrSource(s, lcg);
+    snrEncode();
+    double benchDb = snrDb(snrSrc, snrDec, ALIAS_LEN);
+
+    char path[512];
+    snprintf(path, sizeof(path), "%s/snr%d.ima", dir, k);
+    FILE *in = fopen(path, "rb");
+    size_t size = (in != nullptr) ? fread(file, 1, sizeof(file), in) : 0;
+    if (in != nullptr)
+    {
+      fclose(in);
+    }
+    uint32_t samples = 0, count = 0;
+    if (size >= 8)
+    {
+      memcpy(&samples, file, 4);
+      memcpy(&count, file + 4, 4);
+    }
+    const uint32_t wantCount =
+        (ALIAS_LEN + ADPCM_CHECKPOINT - 1) / ADPCM_CHECKPOINT;
+    const uint8_t *data = file + 8 + wantCount * sizeof(AdpcmState);
+    const uint8_t *decoded = data + (ALIAS_LEN + 1) / 2;
+    if (samples != ALIAS_LEN || count != wantCount ||
+        size != (size_t)(decoded - file) + ALIAS_LEN * sizeof(int16_t))
+    {
+      fprintf(stderr, "%s: not %u samples from the converter\n", path,
+              (unsigned)ALIAS_LEN);
+      return 1;
+    }
+
+    AdpcmDecoder d;
+    adpcmStart(d, data, (const AdpcmState *)(file + 8));
+    int mismatches = 0;
+    for (uint32_t i = 0; i < ALIAS_LEN; i++)
+    {
+      adpcmAdvance(d, i + 1);
+      int16_t want;
+      memcpy(&want, decoded + i * sizeof(int16_t), sizeof(want));
+      mismatches += (d.hist[3] != want);
+      snrDec[i] = d.hist[3];
+    }
+
+    double db = snrDb(snrSrc, snrDec, ALIAS_LEN);
+    bool pass = mismatches == 0 && db >= s.minDb && fabs(db - benchDb) <= 1.0;
+    ok = ok && pass;
+    printf("%-13s %7.1f %9.1f %7.0f %11d%s\n", s.name, db, benchDb, s.minDb,
+           mismatches, pass ? "" : "  FAIL");
+  }
+  return ok ? 0 : 1;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc == 3 && strcmp(argv[1], "--snr-sources") == 0)
+  {
+    return writeSnrSources(argv[2]);
+  }
+  if (argc == 3 && strcmp(argv[1], "--converter") == 0)
+  {
+    return checkConverter(argv[2]);
+  }
+  if (argc != 1)
+  {
+    fprintf(stderr, "usage: %s [--snr-sources DIR | --converter DIR]\n",
+            argv[0]);
+    return 1;
+  }
+
+  decodeSample();
+
+  // err ref: |fixed - exact, rounded| in LSB, must be <= 1. err float:
+  // |fixed - float| at the same step and decay; where the step has more
+  // fraction bits than the float position can keep (pitch 2047) it grows
+  // with the float version's own position drift. The float version isn't
+  // timed: on an x86 FPU it says nothing about soft-float on the M0+.
+  // ns/sample is host time; on target AUDIO_STATS_SERIAL prints the ISR's
+  // cycles per sample.
+  printf("pitch decay  err ref err float host ns/s\n");
+  const int pots[] = {0, 1365, 2047, 2730, 4095};
+  int failed = 0;
+  for (int p : pots)
+  {
+    for (int d : pots)
+    {
+      failed += !comparePlayback(p, d);
+    }
+  }
+
+  // Host time again: on target AUDIO_STATS_SERIAL prints cycles per sample
+  // and the number of active voices.
+  benchVoices();
+  benchAdpcm();
+  benchAliasing();
+  bool snrOk = benchSnr();
+
+  if (failed > 0)
+  {
+    printf("\n%d playback settings more than 1 LSB off the exact rendering\n",
+           failed);
+  }
+  if (!snrOk)
+  {
+    printf("\nADPCM SNR below its threshold\n");
+  }
+  return (failed > 0 || !snrOk) ? 1 : 0;
+}
@@ -0,0 +1,55 @@
+"""Check of wav_converter.py's ADPCM against the firmware's decoder.
+
+    python host/converter_check.py ./drum_bench
+
+Has the host benchmark write its synthetic SNR sources (tones, a kick and
+noise, see benchSnr()), encodes each with wav_converter.adpcm_encode(),
+and has the benchmark decode the result with adpcmAdvance(): the samples
+must match the converter's own decoded ones bit for bit, reach the same
+SNR thresholds as the benchmark, and be within a dB of its encodeLevel().
+Exits non-zero on any mismatch.
+"""
+import glob
+import os
+import struct
+import subprocess
+import sys
+import tempfile
+
+import numpy as np
+
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), ".."))
+import wav_converter  # noqa: E402
+
+
+def write_encoded(path, pcm):
+    """snrN.ima, as checkConverter() in host/bench.cpp reads it."""
+    data, checkpoints, decoded = wav_converter.adpcm_encode(pcm)
+    with open(path, "wb") as f:
+        f.write(struct.pack("<II", len(pcm), len(checkpoints)))
+        f.write(b"".join(struct.pack("<hBB", pred, index, 0)
+                         for pred, index in checkpoints))
+        f.write(data)
+        f.write(decoded.astype("<i2").tobytes())
+
+
+def main():
+    if len(sys.argv) != 2:
+        print(__doc__.strip().splitlines()[2].strip(), file=sys.stderr)
+        return 2
+    bench = os.path.abspath(sys.argv[1])
+    with tempfile.TemporaryDirectory() as tmp:
+        subprocess.run([bench, "--snr-sources", tmp], check=True)
+        sources = sorted(glob.glob(os.path.join(tmp, "snr*.raw")))
+        for path in sources:
+            pcm = np.fromfile(path, dtype="<i2").astype(np.int32)
+            write_encoded(os.path.splitext(path)[0] + ".ima", pcm)
+        result = subprocess.run([bench, "--converter", tmp])
+    ok = result.returncode == 0
+    print(f"convert  {'ok  ' if ok else 'FAIL'}  {len(sources)} sources "
+          f"through wav_converter.py, decoded by adpcmAdvance()")
+    return 0 if ok else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -1,746 +1,641 @@
 // Converted from 909_oh.wav
+#include "bank.h"
+// IMA-ADPCM, two samples per byte (low nibble first)
 const uint8_t sampleData[] = {
-  127,128,131,117,152,71,159,226,28,104,179,149,101,74,148,86,
-  177,113,132,142,97,112,165,137,150,84,153,75,126,133,181,123,
-  101,128,104,157,172,98,132,97,172,116,118,180,134,77,133,145,
-  85,168,147,77,167,194,76,94,116,86,109,139,131,131,62,176,
-  147,60,207,157,38,75,183,129,157,100,105,228,142,15,171,129,
-  132,106,176,110,64,188,141,67,143,137,157,114,100,165,132,151,
-  186,102,110,119,121,133,142,176,70,80,155,143,116,124,139,113,
-  134,94,96,201,56,140,82,150,69,183,154,83,141,147,179,90,
-  115,118,117,128,152,137,20,143,158,129,166,137,117,146,133,119,
-  86,167,156,20,184,139,126,129,133,121,116,192,66,106,114,86,
-  142,140,155,160,131,121,114,156,132,77,197,110,61,203,66,97,
-  131,114,90,178,136,117,140,170,149,93,178,148,116,90,75,150,
-  215,93,95,100,157,178,137,106,140,111,107,138,63,93,184,92,
-  91,133,172,138,73,159,204,118,89,143,110,105,118,173,119,98,
-  114,54,167,176,80,107,168,122,150,132,125,133,161,78,137,133,
-  125,122,178,100,122,119,90,164,119,106,122,98,138,119,138,162,
-  88,181,134,88,139,154,192,42,163,113,121,85,139,128,174,123,
-  171,71,161,57,149,158,103,80,123,205,67,175,151,119,128,111,
-  139,105,162,67,152,107,129,133,95,165,98,138,168,107,68,147,
-  152,150,106,119,113,118,168,129,172,94,110,125,164,99,95,83,
-  170,84,157,193,116,84,123,143,119,206,86,133,183,88,180,114,
-  52,82,135,142,148,179,76,83,156,167,93,148,92,115,114,235,
-  59,104,142,39,176,209,58,138,208,57,149,159,56,87,155,186,
-  130,149,113,115,126,98,184,103,117,142,64,220,137,73,119,165,
-  92,133,98,108,117,149,100,145,164,87,62,126,222,84,142,178,
-  78,66,251,82,83,116,128,169,130,138,123,131,168,86,143,134,
-  78,152,151,151,111,99,154,104,169,129,112,127,101,86,213,101,
-  82,108,113,141,151,101,112,155,100,147,151,107,146,127,87,202,
-  123,94,113,137,113,153,156,116,100,101,175,197,38,114,161,105,
-  87,169,153,165,39,106,194,75,119,128,143,184,98,122,170,116,
-  92,128,161,104,133,112,139,135,88,138,170,95,160,107,109,130,
-  141,166,86,103,146,113,154,122,134,116,132,108,121,137,124,77,
-  112,227,82,49,141,194,113,139,166,153,136,67,143,167,97,109,
-  106,149,69,189,149,100,94,185,78,161,135,99,140,142,93,148,
-  157,84,123,134,126,129,155,118,85,158,146,94,124,92,98,147,
-  111,132,132,144,189,70,146,196,78,150,77,130,153,75,183,129,
-  139,104,93,113,203,129,67,168,97,78,168,121,115,133,162,82,
-  183,114,101,159,158,62,134,162,90,113,172,72,131,196,58,88,
-  202,152,156,164,76,106,89,177,111,182,95,66,154,205,85,136,
-  77,84,178,152,127,70,178,119,84,112,182,102,95,160,148,119,
-  200,99,64,134,132,123,90,134,118,120,159,145,142,125,58,118,
-  181,155,72,133,166,77,149,122,111,122,135,190,154,115,151,91,
-  101,121,174,85,162,114,100,159,119,99,196,119,117,142,121,89,
-  99,173,60,144,120,129,161,66,157,164,88,156,117,103,139,66,
-  138,164,135,120,122,175,126,86,172,145,126,96,119,180,129,109,
-  91,137,144,107,179,149,92,164,83,171,110,75,108,141,148,155,
-  124,64,112,145,134,150,143,78,142,129,112,136,155,77,111,174,
-  111,83,134,140,128,116,144,178,106,135,74,131,162,145,101,107,
-  172,140,181,109,73,122,170,99,174,154,60,146,149,117,97,156,
-  92,112,163,159,114,107,109,117,127,83,119,172,102,110,144,127,
-  128,151,85,167,114,95,125,87,146,138,189,105,137,142,121,126,
-  135,100,179,79,147,132,112,133,80,140,164,146,99,172,165,112,
-  133,119,119,98,98,131,172,84,121,102,187,100,136,147,66,136,
-  115,125,143,96,109,197,135,163,83,119,95,144,199,81,123,125,
-  112,139,113,124,125,122,109,191,188,102,118,118,83,172,134,123,
-  103,105,100,180,148,104,116,92,115,178,94,130,66,131,184,95,
-  99,201,80,108,214,147,124,70,167,112,140,126,123,170,55,123,
-  133,172,165,96,103,141,91,142,149,91,174,71,125,145,108,101,
-  125,148,112,134,164,88,130,107,151,90,120,167,127,139,157,178,
-  123,114,94,150,164,94,105,177,82,72,138,145,124,155,68,158,
-  183,64,154,187,66,107,95,155,133,126,109,168,98,156,136,33,
-  177,124,132,130,104,148,128,162,139,149,120,108,143,124,165,97,
-  106,151,49,118,165,88,128,133,138,114,176,106,154,90,137,103,
-  146,129,154,139,92,182,110,130,115,97,181,118,116,113,153,66,
-  139,136,101,128,144,138,150,121,125,152,142,84,92,110,81,176,
-  146,129,103,118,139,156,150,142,109,107,158,98,162,122,95,152,
-  118,129,173,109,108,121,166,151,110,79,97,127,112,165,113,113,
-  111,168,140,159,95,101,138,146,118,134,149,61,104,94,146,149,
-  145,147,118,159,152,119,126,115,88,163,133,98,87,177,153,79,
-  178,128,154,80,117,170,106,58,106,185,128,79,183,108,131,132,
-  139,149,129,109,122,140,113,138,86,171,105,143,114,123,118,166,
-  112,149,156,99,114,149,87,142,97,102,112,171,159,159,91,138,
-  113,92,155,88,134,114,116,157,160,108,88,127,160,151,117,148,
-  137,82,133,189,52,95,127,136,126,177,147,116,142,114,135,131,
-  110,107,143,121,125,122,165,99,73,169,115,155,131,108,115,139,
-  157,94,115,96,133,142,178,117,124,151,149,132,108,108,117,121,
-  89,138,130,169,96,99,159,108,114,172,161,106,81,162,136,76,
-  109,176,137,137,118,140,134,118,159,119,143,65,145,145,67,155,
-  133,110,130,103,188,141,88,126,155,98,90,155,140,96,97,119,
-  162,158,120,116,134,172,115,69,156,142,97,163,149,97,91,122,
-  153,167,137,112,172,95,78,180,132,68,122,119,150,119,136,131,
-  145,99,148,129,119,143,82,146,102,133,98,152,100,125,148,155,
-  128,145,121,130,129,130,127,95,110,162,103,139,179,100,120,147,
-  112,141,114,115,142,88,137,106,125,107,167,122,164,119,112,166,
-  88,126,141,115,94,152,112,169,127,96,130,138,117,136,135,131,
-  114,155,139,100,115,112,124,166,129,130,135,102,141,126,126,101,
-  100,140,111,134,163,102,114,166,115,141,122,117,115,157,135,87,
-  139,140,109,120,122,169,134,99,133,166,94,107,127,132,110,129,
-  159,148,113,113,139,148,124,92,125,119,141,104,132,104,158,127,
-  109,179,115,108,168,121,137,119,136,92,162,99,101,128,119,135,
-  126,140,107,121,176,113,97,121,151,100,105,154,155,121,129,103,
-  178,135,100,159,101,135,138,94,117,108,144,125,153,113,117,179,
-  142,99,151,140,91,114,104,148,103,111,112,155,123,143,100,142,
-  126,126,129,147,129,96,146,108,140,153,118,144,111,168,134,126,
-  86,103,119,142,125,77,172,109,97,184,140,86,131,149,145,120,
-  145,108,123,101,117,162,122,89,141,143,161,121,122,144,125,114,
-  161,110,93,131,134,138,116,127,157,117,118,139,138,101,118,114,
-  126,137,82,106,138,127,144,132,143,138,138,101,152,134,102,156,
-  75,143,173,106,112,139,98,160,152,94,145,156,121,123,107,110,
-  102,127,161,156,117,117,145,94,115,162,126,104,103,122,178,92,
-  121,141,139,93,135,144,157,85,132,180,108,75,148,122,135,167,
-  108,157,100,81,132,177,127,97,111,144,120,120,164,125,109,98,
-  149,165,109,95,121,151,138,113,129,142,65,145,170,132,115,92,
-  152,148,128,98,135,120,98,143,177,142,72,104,125,142,163,103,
-  139,151,72,125,146,120,96,150,157,129,136,127,128,97,129,156,
-  138,86,115,110,169,140,100,103,151,115,124,142,160,102,136,128,
-  130,135,88,137,156,116,127,109,152,152,112,136,103,110,152,107,
-  109,142,113,131,146,116,125,139,142,135,138,106,98,151,133,86,
-  119,135,139,118,134,143,147,143,116,111,94,139,147,112,133,116,
-  138,135,115,168,134,107,113,153,131,124,97,106,141,124,104,116,
-  154,139,127,98,169,152,86,124,135,136,118,108,123,133,121,115,
-  152,139,121,126,144,135,129,138,126,102,139,120,106,150,118,120,
-  151,122,132,146,126,106,124,121,108,146,119,82,116,146,117,163,
-  131,154,113,138,133,124,105,100,129,115,138,136,129,133,135,132,
-  172,131,94,129,113,135,140,132,111,129,94,141,174,90,113,128,
-  119,151,147,97,128,73,107,178,124,130,115,117,167,152,116,127,
-  145,88,125,148,146,99,87,126,157,135,130,129,100,150,152,124,
-  145,99,100,131,127,134,133,103,123,146,142,133,112,100,146,173,
-  86,129,126,122,126,127,141,129,98,154,157,108,144,121,106,135,
-  113,127,120,126,87,145,135,100,166,147,105,130,110,121,137,116,
-  123,151,127,122,95,151,164,92,146,140,106,136,158,133,115,111,
-  115,140,162,122,122,130,124,121,134,137,86,113,168,126,119,102,
-  136,117,127,125,135,128,100,113,153,154,109,99,130,118,130,147,
-  175,124,100,116,144,135,120,114,138,120,104,178,131,101,125,135,
-  103,140,125,112,104,160,131,142,117,106,131,131,156,148,92,136,
-  96,136,145,115,126,107,95,169,169,112,117,100,130,133,127,129,
-  128,135,115,138,142,116,107,103,126,177,107,128,136,113,148,140,
-  108,135,119,128,151,139,127,113,153,110,103,162,151,96,115,146,
-  123,97,99,131,166,113,100,131,150,122,131,127,119,110,118,143,
-  118,113,111,148,148,116,110,152,118,136,142,154,115,113,144,119,
-  123,139,131,125,140,127,140,162,100,99,102,123,120,137,156,112,
-  90,105,153,152,106,94,163,150,124,92,166,123,80,129,153,128,
-  115,150,113,140,140,135,113,137,113,131,150,111,136,113,128,114,
-  120,156,121,105,132,122,141,123,127,102,105,152,118,122,130,106,
-  168,142,114,136,148,122,127,111,149,156,97,111,121,154,115,104,
-  145,151,108,137,152,96,121,114,105,146,96,116,141,108,148,126,
-  134,118,110,149,129,121,116,129,137,125,136,142,127,141,143,143,
-  121,115,150,151,72,119,133,117,139,120,128,117,146,120,129,123,
-  138,117,109,145,120,98,139,111,147,155,94,118,109,163,127,120,
-  157,110,106,149,139,103,141,132,128,123,131,144,141,119,93,160,
-  137,72,119,159,105,124,124,121,144,117,110,156,162,128,96,131,
-  160,97,108,162,121,92,137,132,134,135,105,154,129,90,139,147,
-  122,108,124,123,126,124,131,151,109,117,153,102,129,134,134,129,
-  126,107,158,152,81,154,141,123,127,128,124,124,134,130,137,113,
-  131,97,151,153,84,114,124,117,134,127,135,113,135,120,133,151,
-  124,121,132,98,117,163,134,94,115,140,141,140,133,127,113,131,
-  148,123,115,107,134,135,126,125,161,110,85,157,138,141,99,109,
-  141,134,143,128,111,96,124,140,162,150,102,101,155,134,128,110,
-  120,123,123,136,153,98,112,129,146,130,130,123,124,121,143,108,
-  129,113,100,155,144,123,127,132,120,118,148,137,130,79,162,137,
-  101,131,116,138,123,145,142,142,121,108,151,132,106,98,129,133,
-  122,138,123,102,135,134,140,124,135,88,122,183,108,103,132,110,
-  120,160,119,142,127,115,165,152,116,100,93,150,108,138,150,98,
-  130,139,120,145,141,104,107,150,170,118,102,97,115,124,139,143,
-  129,108,132,168,119,120,114,90,151,115,125,145,101,120,159,148,
-  105,143,121,124,143,125,136,133,94,112,137,142,100,126,156,115,
-  131,149,123,128,129,119,123,136,119,105,170,111,109,157,112,118,
-  138,128,136,139,89,122,112,158,104,113,141,109,131,171,125,107,
-  145,116,115,134,138,127,126,128,129,132,124,130,130,150,120,106,
-  162,134,96,119,143,113,116,129,128,116,133,122,134,143,110,105,
-  143,143,106,107,119,132,122,149,129,128,140,129,114,154,129,119,
-  138,99,123,154,110,123,134,151,131,129,128,128,131,116,108,126,
-  149,116,111,132,137,114,112,149,117,122,122,144,131,121,95,143,
-  113,107,133,146,113,128,141,144,128,114,143,147,118,114,117,138,
-  139,109,145,134,125,101,156,103,142,122,111,114,116,168,119,149,
-  116,127,129,119,142,126,113,134,111,147,128,125,114,127,145,105,
-  130,126,117,133,123,126,118,108,120,164,133,122,106,146,135,104,
-  164,97,136,140,89,157,132,119,126,131,134,113,144,136,126,127,
-  133,135,115,99,156,117,105,147,109,118,124,161,125,105,135,110,
-  98,162,157,94,116,136,152,119,144,114,129,156,112,127,128,129,
-  81,151,151,114,120,112,132,135,165,124,82,136,135,145,110,125,
-  128,97,108,149,126,146,131,90,149,144,118,118,131,130,122,129,
-  148,114,138,130,121,162,117,117,140,119,105,151,123,94,124,108,
-  139,134,119,110,133,169,132,140,105,78,145,157,110,108,114,146,
-  137,114,149,145,125,126,123,161,139,90,117,135,129,115,128,135,
-  133,110,146,121,131,142,107,99,167,117,110,114,101,142,131,158,
-  80,123,146,151,133,134,117,118,139,120,109,122,131,113,123,171,
-  118,138,144,118,166,156,103,89,133,97,140,133,101,115,142,139,
-  121,144,133,128,87,148,125,156,89,105,96,157,164,83,129,156,
-  126,116,152,151,83,130,126,103,113,155,120,101,161,129,145,132,
-  131,113,162,131,122,109,105,163,94,133,157,98,97,146,131,125,
-  164,114,95,162,139,107,141,104,99,165,134,102,133,149,100,127,
-  135,141,112,99,109,115,177,120,112,119,133,129,142,147,115,132,
-  146,141,89,150,112,100,146,138,128,115,105,111,176,133,113,117,
-  155,107,123,158,125,129,108,144,130,125,134,122,130,109,124,125,
-  120,105,126,135,145,102,127,143,136,135,103,148,115,135,141,117,
-  139,112,142,141,94,121,131,134,123,111,149,131,102,112,152,157,
-  133,119,111,143,145,140,97,127,110,106,154,148,97,134,107,125,
-  182,117,94,120,117,153,145,99,110,158,120,130,133,137,95,134,
-  146,99,130,141,99,121,143,139,107,128,135,129,130,127,139,130,
-  134,143,126,115,121,116,141,135,136,87,109,141,144,140,99,127,
-  134,122,141,135,131,118,98,138,142,124,103,126,137,163,120,108,
-  122,106,152,117,142,128,98,120,155,132,141,116,121,152,119,153,
-  122,97,108,137,157,126,128,112,113,118,145,158,107,105,119,142,
-  134,123,120,120,143,120,130,145,123,105,150,119,135,107,136,114,
-  144,110,140,100,138,130,153,115,106,126,108,158,144,116,104,133,
-  125,138,128,138,109,118,124,146,140,112,119,142,143,103,112,137,
-  120,134,156,105,129,108,137,132,133,155,113,106,125,101,140,144,
-  121,111,133,144,114,169,126,103,122,122,109,146,134,121,130,163,
-  132,107,134,123,129,126,131,112,114,131,129,125,121,118,127,141,
-  129,137,126,115,122,120,159,95,129,123,106,156,142,122,101,137,
-  150,133,127,106,144,144,88,130,141,119,124,124,129,123,153,123,
-  115,130,159,133,107,99,118,156,114,135,99,128,150,134,116,152,
-  129,106,111,145,147,118,110,111,124,146,126,120,129,145,112,113,
-  122,151,107,111,137,129,103,134,148,114,134,144,155,95,137,155,
-  130,114,94,141,130,149,96,136,132,126,126,121,152,118,130,115,
-  128,123,118,136,128,122,132,144,114,94,144,153,115,119,103,122,
-  155,122,100,143,126,118,128,146,138,109,134,115,136,136,126,133,
-  112,138,141,132,98,135,142,127,116,85,142,150,135,142,114,139,
-  154,102,133,113,150,126,83,130,130,137,111,115,139,141,119,104,
-  138,133,131,109,147,106,129,143,115,109,140,141,117,119,148,142,
-  123,95,155,133,112,149,101,120,144,129,136,137,132,116,140,137,
-  120,131,130,104,123,137,134,108,94,121,146,136,132,127,138,114,
-  133,152,85,123,127,127,148,112,128,112,144,118,136,167,110,110,
-  105,140,147,110,103,139,152,97,130,154,127,112,142,141,123,122,
-  151,98,100,141,140,119,110,126,143,168,116,109,125,137,95,117,
-  161,130,114,114,125,141,132,106,116,146,120,127,130,139,78,141,
-  152,111,131,111,136,138,145,133,146,140,89,113,160,131,103,152,
-  116,136,120,144,122,115,117,130,129,127,122,130,139,109,129,135,
-  106,126,136,126,145,127,96,136,136,110,138,111,125,145,120,126,
-  117,152,117,114,138,126,157,115,116,128,123,132,124,120,132,139,
-  149,115,135,111,136,127,113,116,123,135,123,127,156,133,96,132,
-  143,129,142,98,131,134,114,134,124,127,104,129,143,143,134,113,
-  130,102,140,133,131,103,118,123,144,142,122,123,124,128,140,152,
-  113,83,144,136,120,137,116,114,124,149,160,98,145,94,125,161,
-  119,130,105,122,122,158,137,93,138,124,150,111,149,134,83,134,
-  129,138,118,111,104,146,164,103,111,117,129,155,143,124,117,126,
-  120,156,118,92,135,125,129,139,146,125,118,129,126,152,109,102,
-  160,104,114,118,132,142,116,137,119,158,113,116,148,117,120,128,
-  138,103,138,143,117,132,115,109,126,169,133,114,106,131,139,101,
-  139,147,118,120,126,129,132,116,134,110,128,135,142,105,127,152,
-  117,121,123,157,112,126,140,115,134,133,111,129,137,130,145,119,
-  105,133,133,130,99,112,142,127,127,124,146,124,116,118,118,138,
-  113,126,145,113,134,123,138,132,124,133,106,150,123,156,130,109,
-  116,134,147,102,114,154,143,103,134,128,135,131,83,144,129,102,
-  155,124,116,115,149,125,112,129,127,145,139,106,135,123,138,124,
-  136,125,102,133,125,131,138,138,113,118,139,125,136,88,157,128,
-  102,123,138,129,127,137,116,131,124,127,142,125,117,125,119,131,
-  132,146,117,107,148,140,140,120,108,120,157,134,107,104,108,150,
-  121,137,141,121,119,116,137,150,133,97,135,114,137,145,118,113,
-  123,157,118,135,117,125,120,145,130,137,110,109,126,128,136,136,
-  114,101,142,165,121,134,101,112,134,140,111,132,106,126,148,115,
-  138,124,122,128,145,135,136,115,102,146,150,117,99,116,148,130,
-  132,121,128,132,106,141,125,133,120,108,125,126,147,127,112,138,
-  138,137,123,118,139,142,105,125,111,126,129,132,143,113,134,127,
-  121,130,124,131,130,111,123,148,130,115,117,123,143,143,104,127,
-  151,113,114,137,139,118,115,117,143,135,139,109,120,151,136,109,
-  135,131,103,141,127,129,129,115,122,119,144,140,119,117,109,137,
-  156,119,101,128,121,152,133,105,115,137,129,134,145,117,126,122,
-  120,140,135,136,106,107,142,158,106,107,127,142,124,129,142,117,
-  129,113,120,141,119,142,109,117,132,142,138,109,108,144,154,119,
-  96,140,143,117,115,143,130,113,117,139,135,126,117,148,107,127,
-  148,124,109,117,160,108,122,128,149,133,120,108,122,165,111,120,
-  129,123,121,124,135,128,121,123,134,131,124,132,111,126,128,137,
-  136,120,96,147,147,119,110,123,138,130,130,110,142,143,103,117,
-  159,120,115,133,112,118,167,143,98,123,128,149,117,112,134,157,
-  100,111,140,129,131,136,119,121,132,124,130,122,136,130,105,128,
-  113,141,149,115,104,128,154,107,110,143,139,118,141,106,127,153,
-  115,106,154,126,121,132,133,127,127,135,122,111,134,137,134,114,
-  111,135,115,116,128,166,110,113,123,139,145,113,118,129,131,143,
-  117,120,138,109,134,156,94,120,155,103,126,127,155,125,99,145,
-  142,128,112,124,133,130,134,139,118,118,115,133,134,116,130,133,
-  122,104,152,133,127,112,124,141,140,132,110,130,128,118,133,130,
-  117,100,142,134,123,126,136,118,107,146,137,119,99,126,149,157,
-  107,116,131,128,147,126,130,124,115,145,117,135,132,108,121,140,
-  130,136,130,94,135,160,110,123,129,137,113,128,145,118,118,146,
-  97,133,130,111,133,146,107,139,129,111,120,138,123,141,116,132,
-  126,136,128,134,113,114,118,149,136,119,129,118,149,121,132,118,
-  108,141,153,127,112,137,106,124,142,138,103,133,119,131,137,131,
-  129,108,130,108,140,135,126,113,122,141,130,132,125,120,117,149,
-  129,114,143,96,124,147,122,123,129,132,116,143,150,117,120,120,
-  139,119,132,149,115,117,122,141,130,132,122,87,166,117,125,128,
-  117,119,128,139,127,130,130,121,124,128,147,116,117,130,131,132,
-  119,113,127,124,138,120,125,129,134,113,128,146,117,142,112,129,
-  139,135,106,127,158,106,129,119,117,147,133,111,126,151,116,129,
-  119,129,134,131,105,129,153,121,134,122,118,137,100,135,134,110,
-  127,137,115,134,132,120,114,147,118,140,136,121,106,144,146,106,
-  123,136,125,126,148,103,131,137,99,134,146,107,143,127,119,140,
-  130,130,108,130,134,136,110,130,123,133,138,110,121,114,141,119,
-  110,163,129,124,121,107,144,140,131,117,129,140,132,126,106,146,
-  118,96,130,139,130,125,118,147,130,120,118,121,107,173,126,111,
-  130,133,126,139,129,104,146,126,116,130,128,132,116,132,134,123,
-  133,117,131,138,131,123,114,133,108,147,122,115,132,122,130,129,
-  115,128,122,107,122,156,128,133,132,112,134,144,122,121,128,124,
-  125,140,121,141,120,116,114,141,137,127,136,96,141,151,115,118,
-  111,150,127,116,141,126,125,115,129,138,126,112,121,129,126,146,
-  121,113,122,120,150,141,115,127,132,127,121,147,126,134,115,115,
-  136,129,135,102,125,131,127,129,135,102,145,156,109,110,145,135,
-  106,113,146,137,124,116,126,134,133,126,121,115,135,124,125,123,
-  120,128,141,123,122,135,132,126,126,138,120,116,126,116,136,142,
-  114,99,157,140,114,131,109,124,157,138,113,117,138,136,131,119,
-  122,140,109,115,145,139,121,103,115,135,129,133,127,119,128,139,
-  125,128,126,132,123,120,120,147,132,111,122,130,148,125,107,133,
-  135,119,139,128,119,130,137,127,126,137,101,136,108,131,155,108,
-  117,110,134,153,121,109,127,137,128,132,131,125,130,129,123,152,
-  112,131,126,116,124,126,133,123,112,124,151,120,110,121,155,114,
-  131,124,127,138,109,126,141,121,121,126,139,122,132,115,124,130,
-  132,131,121,127,127,136,129,121,122,142,119,130,128,129,119,120,
-  126,124,145,126,107,127,124,132,135,117,122,134,128,142,116,134,
-  128,120,126,136,147,118,112,123,124,142,114,133,123,137,123,129,
-  135,119,120,141,124,115,128,137,124,117,134,131,118,121,141,121,
-  126,119,129,126,126,136,117,145,125,114,137,117,126,148,130,113,
-  117,128,137,133,122,120,112,138,138,116,130,131,118,134,131,116,
-  142,123,116,138,131,111,135,131,132,135,119,120,123,139,116,129,
-  137,129,126,121,132,115,139,128,131,108,130,133,118,132,129,124,
-  120,127,126,119,128,143,113,131,141,101,126,149,132,108,137,127,
-  117,161,110,121,144,116,113,147,127,123,134,132,129,120,128,119,
-  126,114,146,130,120,134,118,122,139,130,118,115,125,124,136,146,
-  113,108,119,141,137,123,129,126,134,129,127,143,114,109,131,139,
-  126,125,122,133,123,140,131,128,102,120,145,130,137,139,108,124,
-  127,128,130,130,114,125,138,130,137,127,106,120,119,143,145,96,
-  123,135,131,126,131,125,131,125,135,136,115,117,137,126,121,140,
-  109,128,125,129,148,119,119,127,136,133,123,120,130,134,126,124,
-  133,134,124,121,125,142,119,121,123,128,129,128,111,126,135,117,
-  140,124,125,131,131,130,115,128,124,139,112,134,144,109,127,123,
-  134,133,138,112,121,138,126,128,133,116,116,140,132,126,118,139,
-  122,111,157,125,114,112,130,122,153,132,104,131,126,132,126,126,
-  129,133,123,135,129,122,136,103,123,123,141,132,117,114,124,152,
-  125,119,120,128,131,111,145,144,113,106,140,126,134,124,124,130,
-  129,150,118,117,120,136,123,129,130,121,129,134,120,139,120,127,
-  133,122,128,134,120,119,124,134,125,131,118,133,129,116,133,117,
-  134,122,136,129,129,121,139,124,123,134,131,122,117,140,123,124,
-  121,127,145,119,126,115,133,130,133,129,110,131,131,127,122,132,
-  132,131,119,143,118,120,128,116,133,125,131,122,136,130,132,126,
-  106,133,133,126,121,140,132,117,137,118,121,132,124,121,121,142,
-  120,122,125,140,126,123,127,134,130,119,132,133,125,120,120,132,
-  118,135,137,135,116,128,140,116,120,129,129,125,125,124,134,131,
-  125,122,127,124,115,149,112,125,129,131,130,129,129,135,108,128,
-  138,128,133,127,117,118,137,135,122,116,126,136,140,122,122,131,
-  120,127,125,138,123,122,126,130,133,129,118,119,133,135,121,120,
-  134,137,114,124,130,136,120,130,129,124,138,128,121,111,128,141,
-  123,130,114,132,122,134,125,125,119,120,149,130,115,136,134,99,
-  140,134,128,119,134,124,132,146,109,132,124,124,126,130,132,124,
-  123,131,123,124,135,115,129,132,126,122,138,142,99,131,130,120,
-  124,117,150,118,117,144,126,113,129,128,137,126,128,122,128,134,
-  115,128,128,132,133,135,117,116,142,136,104,127,126,132,122,123,
-  149,124,119,124,135,136,122,133,114,124,147,108,129,136,113,133,
-  138,120,121,131,118,117,146,128,120,122,132,125,137,132,102,130,
-  147,113,129,133,123,114,131,135,131,125,113,137,127,126,136,131,
-  122,124,134,123,137,110,136,139,104,135,137,118,118,130,128,123,
-  142,126,125,118,128,129,127,125,122,128,132,119,134,127,124,124,
-  128,131,127,126,120,125,135,128,119,132,133,130,125,125,135,123,
-  128,127,133,127,123,122,136,122,123,125,132,123,130,124,136,131,
-  121,129,129,114,125,143,126,125,128,116,131,138,118,119,127,130,
-  127,122,127,128,126,128,131,122,125,130,133,116,139,132,107,131,
-  130,125,133,127,137,121,136,112,123,150,117,112,133,126,126,141,
-  128,131,121,128,129,130,124,117,134,121,129,123,123,127,127,129,
-  126,123,118,125,134,131,129,132,118,129,133,127,131,116,129,135,
-  118,128,132,133,129,125,121,138,119,128,122,117,136,125,127,124,
-  135,126,132,124,129,128,123,126,131,128,119,128,119,123,133,132,
-  129,129,132,124,125,124,134,137,112,120,131,127,127,135,122,126,
-  119,134,128,126,122,124,132,123,133,128,127,126,124,134,129,132,
-  120,121,139,121,121,139,116,129,134,130,128,133,129,106,129,134,
-  128,130,117,125,133,128,129,119,125,133,112,136,135,123,126,115,
-  134,131,128,118,126,143,118,142,127,113,141,119,131,123,127,137,
-  129,121,120,131,139,115,115,134,131,126,135,132,115,123,134,126,
-  124,126,126,127,118,138,133,125,113,125,144,121,129,120,136,134,
-  116,125,123,126,137,118,132,138,127,119,133,117,122,131,134,121,
-  127,136,120,127,120,134,135,120,122,124,144,127,113,137,120,126,
-  147,127,115,122,143,111,119,129,128,131,123,130,131,133,136,104,
-  130,149,116,108,129,130,131,124,131,128,128,126,112,143,139,126,
-  121,119,135,125,134,117,108,140,137,136,117,127,130,121,129,122,
-  132,130,113,133,134,125,119,130,127,124,129,137,120,134,119,135,
-  132,121,122,137,128,109,134,140,116,115,129,132,128,129,124,136,
-  121,131,129,123,118,127,134,123,124,130,136,131,117,124,131,129,
-  125,119,133,133,126,122,129,138,115,128,131,132,125,127,129,116,
-  131,138,118,126,122,139,132,121,122,131,132,116,114,141,132,118,
-  126,138,125,127,122,125,131,130,124,120,129,129,127,125,123,126,
-  143,123,114,125,141,135,116,116,136,132,123,123,133,121,135,124,
-  124,135,131,110,126,148,119,117,137,120,130,137,123,121,126,131,
-  129,127,126,128,135,131,120,114,140,131,113,120,129,124,129,133,
-  124,125,136,133,122,123,134,126,123,126,125,127,127,125,124,135,
-  124,117,132,131,122,134,116,130,136,125,120,129,131,133,126,123,
-  126,116,150,127,116,123,132,128,125,130,124,136,119,120,132,131,
-  124,129,125,127,135,122,122,127,130,129,129,118,132,132,125,118,
-  131,132,123,117,126,144,127,126,125,122,135,123,128,123,130,132,
-  127,118,125,142,113,128,131,125,133,122,125,131,122,127,132,123,
-  130,132,128,122,131,126,123,124,121,141,123,123,130,123,125,131,
-  125,127,124,123,125,140,119,125,141,119,124,128,127,126,127,127,
-  130,130,126,116,121,145,125,121,135,128,128,132,116,131,131,124,
-  124,121,134,134,122,119,125,129,128,121,134,133,124,124,124,138,
-  124,118,134,130,129,123,120,134,126,127,128,120,120,133,131,134,
-  119,120,129,137,111,134,136,122,125,134,125,126,123,133,127,117,
-  133,125,129,126,135,131,115,120,140,131,125,123,136,137,120,126,
-  116,135,128,119,135,129,124,128,122,129,122,122,124,130,126,129,
-  137,122,119,129,130,131,126,124,130,132,117,128,134,127,119,128,
-  133,120,127,130,132,119,126,138,118,118,127,149,121,123,126,130,
-  134,127,120,131,135,125,117,133,128,117,121,135,126,126,133,121,
-  128,146,120,116,128,132,130,126,126,123,130,125,128,119,130,127,
-  127,129,123,143,112,119,135,129,122,126,128,127,136,125,127,133,
-  120,124,131,130,123,125,134,114,118,143,125,112,126,134,130,129,
-  133,121,130,130,129,125,128,121,131,136,124,118,132,133,116,127,
-  132,138,119,120,136,124,129,116,127,124,130,117,132,142,125,118,
-  128,129,125,127,131,126,117,135,136,115,123,131,130,132,119,135,
-  135,122,120,125,134,127,124,127,133,131,125,124,129,125,123,128,
-  125,127,136,123,122,123,128,142,118,119,128,125,134,130,129,128,
-  124,125,124,123,136,129,112,131,136,128,120,127,127,123,130,131,
-  124,125,138,116,126,126,129,132,126,129,126,139,128,114,123,133,
-  122,139,125,123,123,128,135,123,127,134,122,118,134,135,124,123,
-  121,126,138,128,112,132,127,139,119,123,133,124,124,126,130,129,
-  129,125,116,134,131,122,128,123,126,144,117,124,125,129,131,116,
-  131,144,119,116,127,129,123,129,130,128,129,126,133,127,128,127,
-  122,129,117,131,138,126,119,126,135,124,124,125,125,126,134,128,
-  117,128,130,126,116,127,141,129,119,122,138,135,118,125,123,129,
-  129,127,122,132,133,118,129,126,133,126,126,130,124,132,128,117,
-  136,127,122,124,130,133,130,127,122,125,133,124,120,127,128,128,
-  130,127,128,119,135,124,121,129,131,132,118,129,131,129,124,114,
-  132,133,130,124,125,129,129,122,131,130,126,123,133,126,118,130,
-  122,126,134,131,127,127,126,122,135,129,117,128,133,123,121,129,
-  129,132,126,127,127,131,126,125,129,124,122,129,132,118,123,135,
-  126,124,130,137,136,110,121,137,124,120,123,139,131,122,121,128,
-  132,129,125,130,123,132,128,129,118,126,129,129,128,133,123,123,
-  131,124,130,137,115,125,136,128,115,129,129,118,127,127,129,130,
-  124,129,128,129,125,132,125,129,120,123,132,126,122,127,131,127,
-  129,131,125,122,138,125,123,127,131,116,130,129,129,133,123,124,
-  125,144,115,125,121,130,132,113,139,129,125,124,121,133,131,130,
-  118,133,132,125,128,133,117,125,130,130,124,122,134,119,123,129,
-  133,122,126,123,134,137,128,119,133,126,114,135,129,124,122,129,
-  132,125,129,130,123,122,130,130,127,120,123,135,125,130,121,133,
-  135,114,132,126,130,113,127,138,130,120,128,122,135,129,120,134,
-  123,131,134,124,124,126,122,132,130,124,129,120,125,138,133,117,
-  120,128,123,133,129,124,126,130,125,128,134,119,123,130,131,125,
-  127,129,126,126,132,128,123,125,116,133,131,129,130,120,128,133,
-  131,126,124,124,125,134,121,132,124,114,130,137,135,122,128,124,
-  131,132,119,119,127,127,125,135,124,131,122,131,135,121,127,124,
-  122,129,131,124,133,121,126,128,127,129,133,131,127,120,126,138,
-  119,125,127,121,132,132,128,122,128,128,131,130,122,128,128,127,
-  126,122,128,130,127,123,136,124,121,124,124,132,127,126,129,128,
-  126,127,128,122,133,124,122,132,125,131,132,124,123,134,126,114,
-  137,127,121,127,125,127,130,134,124,129,139,114,130,131,120,113,
-  138,126,127,130,128,133,116,128,132,132,114,120,135,128,125,127,
-  127,129,127,130,130,124,127,126,126,126,126,127,126,133,118,130,
-  130,126,126,127,135,123,122,129,132,120,127,130,131,131,122,130,
-  124,135,123,123,130,118,129,132,125,121,130,133,127,129,132,125,
-  130,122,128,124,123,127,127,128,125,130,118,134,129,123,130,126,
-  128,123,129,131,122,130,130,125,121,130,131,137,122,116,130,134,
-  130,120,127,127,121,128,134,130,124,127,132,126,136,121,119,139,
-  120,126,129,120,118,134,139,117,124,130,127,125,130,133,124,123,
-  126,130,122,132,123,126,129,129,128,130,125,124,125,133,121,129,
-  123,125,129,124,134,128,128,121,130,138,126,120,122,132,126,129,
-  121,127,130,125,133,129,120,130,130,122,123,123,127,125,135,129,
-  131,120,126,129,129,131,124,128,119,123,136,127,126,122,134,119,
-  127,136,127,125,123,130,128,134,130,118,128,135,127,125,123,122,
-  124,139,121,126,130,121,122,135,130,123,131,118,133,130,128,129,
-  120,128,127,130,125,126,128,123,129,129,128,124,126,126,130,129,
-  124,128,131,122,129,132,125,117,132,129,127,135,128,124,122,126,
-  132,126,124,126,127,124,135,128,123,127,126,133,128,128,119,129,
-  132,120,121,130,127,124,129,132,127,126,127,135,119,127,125,123,
-  138,124,125,136,121,123,124,138,126,119,131,132,120,125,125,132,
-  127,125,127,136,127,123,131,128,123,126,131,125,122,123,130,127,
-  129,127,129,128,121,130,127,126,128,123,131,123,126,133,129,116,
-  133,138,120,128,126,127,117,129,134,123,129,130,120,132,133,117,
-  127,129,130,128,131,124,124,126,128,134,122,121,127,131,122,130,
-  135,122,127,127,131,129,127,118,128,132,122,131,125,125,128,130,
-  127,128,125,130,120,135,125,119,131,123,130,125,139,122,122,132,
-  131,121,131,125,125,131,127,122,128,125,129,128,128,130,121,132,
-  136,119,125,124,127,123,125,140,128,117,125,130,138,125,118,132,
-  127,128,125,123,135,121,130,125,121,131,129,125,131,123,134,127,
-  117,128,134,123,124,133,123,124,125,128,127,133,120,134,125,127,
-  134,125,123,121,131,127,130,127,120,132,124,126,132,126,131,124,
-  122,132,128,129,126,123,134,125,124,130,124,125,134,128,118,135,
-  120,124,130,124,131,128,118,130,131,128,128,128,125,125,129,128,
-  130,122,130,127,119,130,128,125,132,123,126,130,129,125,129,129,
-  131,120,131,127,125,138,117,121,128,136,130,117,127,130,128,125,
-  123,129,129,126,126,128,130,122,123,130,131,133,126,123,124,133,
-  129,120,127,129,126,122,128,132,127,123,130,127,125,131,128,128,
-  122,132,126,128,127,123,127,129,129,127,128,131,125,125,126,127,
-  124,126,121,130,133,124,129,120,130,125,133,124,133,126,124,125,
-  124,134,127,122,117,131,129,133,126,127,124,131,128,130,125,125,
-  130,125,129,123,129,127,119,136,132,125,121,126,130,131,131,119,
-  123,127,127,129,132,121,129,134,125,125,129,130,121,126,131,125,
-  125,124,126,130,126,127,122,128,134,131,126,123,125,127,125,128,
-  133,120,124,127,129,130,128,127,127,125,128,136,124,114,132,134,
-  124,129,125,128,130,126,130,129,123,125,131,130,123,124,125,125,
-  126,129,131,125,128,126,129,131,121,122,134,125,125,129,128,128,
-  129,123,129,128,125,126,123,131,132,126,128,124,124,130,130,123,
-  126,129,123,128,130,130,128,119,128,129,130,123,126,135,126,121,
-  126,128,127,124,139,122,124,127,131,129,128,123,129,129,123,126,
-  131,130,120,129,130,117,125,130,130,124,131,125,126,132,130,121,
-  129,126,125,128,124,127,124,129,131,126,127,121,138,126,121,132,
-  126,120,130,130,126,127,130,130,127,126,129,129,123,123,125,127,
-  126,129,130,124,127,122,131,134,127,122,129,126,127,129,121,125,
-  132,127,131,125,123,129,128,126,122,132,129,119,132,129,125,126,
-  132,120,132,131,119,134,126,125,125,131,125,130,120,128,127,127,
-  130,125,128,128,127,127,131,128,118,132,134,121,127,122,127,130,
-  127,132,121,125,133,126,123,124,126,128,128,124,133,124,124,131,
-  130,127,125,125,124,132,130,127,122,132,122,124,130,124,131,122,
-  127,134,128,127,128,120,132,124,133,126,122,126,130,130,123,131,
-  123,123,134,128,124,126,121,127,137,123,126,128,128,128,126,134,
-  124,118,128,134,126,124,126,124,134,121,128,126,124,126,133,129,
-  126,128,128,131,126,124,128,126,124,133,125,126,130,122,126,135,
-  124,125,127,131,121,129,128,122,130,127,122,131,128,123,128,126,
-  125,124,138,124,119,129,126,131,118,128,131,125,132,131,127,126,
-  126,131,126,124,129,123,127,131,127,128,125,128,128,122,130,127,
-  128,124,126,127,126,128,128,123,130,125,129,133,123,124,125,128,
-  127,128,128,121,132,132,125,126,127,124,132,125,127,131,126,124,
-  130,127,124,126,123,131,123,131,128,121,131,126,128,127,129,127,
-  127,128,126,130,127,125,125,130,126,128,125,128,126,127,135,117,
-  124,131,126,121,133,127,126,127,131,125,129,127,124,130,124,129,
-  124,126,126,125,133,128,122,130,133,124,125,128,122,129,133,124,
-  123,134,124,125,130,122,123,128,129,127,130,128,123,131,128,126,
-  125,128,128,127,131,120,128,130,128,126,130,121,128,135,121,128,
-  126,125,127,130,126,124,126,130,130,120,133,132,121,125,128,125,
-  129,127,123,128,126,129,126,128,129,128,127,129,128,128,125,119,
-  137,128,122,126,129,126,131,132,119,126,129,127,126,126,125,127,
-  129,124,130,128,129,123,128,131,126,125,125,129,122,133,131,119,
-  123,132,128,126,127,124,131,129,126,126,131,126,122,130,129,126,
-  123,127,128,130,127,128,129,124,127,126,126,126,125,127,129,128,
-  129,127,128,124,126,135,126,124,123,128,130,124,127,123,128,129,
-  130,127,126,129,124,133,126,123,130,126,125,122,135,129,122,125,
-  133,125,128,127,124,124,128,125,126,130,126,127,127,126,128,127,
-  127,123,128,136,121,120,135,125,125,131,118,128,131,128,123,133,
-  127,125,126,132,129,124,126,126,127,131,127,124,127,125,129,132,
-  122,127,126,130,127,126,129,122,127,128,129,129,126,122,131,126,
-  128,125,124,132,125,127,129,130,121,127,126,125,126,127,128,128,
-  127,127,134,123,125,129,124,131,127,125,127,125,132,126,128,127,
-  127,124,129,126,126,132,126,123,129,129,125,129,124,126,126,127,
-  127,128,133,120,126,132,128,127,122,127,122,132,128,123,130,128,
-  127,127,129,123,127,127,127,126,130,127,124,123,127,131,129,130,
-  124,126,127,128,128,131,124,126,127,129,130,127,126,126,129,129,
-  122,130,127,127,128,125,127,125,126,126,126,128,130,128,130,122,
-  130,127,126,126,124,128,125,128,130,126,125,124,132,126,126,130,
-  126,131,125,122,132,133,119,128,128,127,128,131,125,127,124,128,
-  128,127,127,125,125,127,132,124,128,121,127,129,127,132,123,128,
-  126,127,126,127,128,126,121,129,133,127,124,128,124,127,132,127,
-  126,126,125,127,133,124,125,126,127,128,130,129,123,128,129,128,
-  126,125,124,128,129,126,130,129,125,126,124,130,127,125,129,124,
-  128,127,126,129,126,126,123,132,128,121,129,126,125,125,130,129,
-  126,128,128,127,127,124,129,131,122,127,128,127,125,128,127,125,
-  126,130,126,128,124,126,134,124,127,127,127,129,126,128,127,125,
-  126,129,130,127,126,125,125,129,128,128,129,125,125,127,129,125,
-  130,126,122,129,127,125,134,120,126,132,131,123,124,130,124,123,
-  129,130,125,127,128,130,125,126,127,126,127,126,129,127,125,128,
-  131,126,120,132,128,120,135,123,126,132,128,126,125,129,129,123,
-  131,128,121,127,126,130,126,126,128,128,127,128,129,127,121,128,
-  129,125,123,124,131,127,130,130,126,122,129,128,128,126,127,127,
-  127,126,127,129,125,126,129,129,132,125,121,128,131,125,127,128,
-  123,127,133,126,124,127,125,127,133,131,121,125,127,128,130,124,
-  130,123,127,131,125,127,128,127,126,131,127,125,124,129,130,125,
-  126,124,126,129,127,127,130,126,124,131,128,126,127,125,125,130,
-  125,128,128,126,127,126,127,127,128,128,128,130,125,125,125,128,
-  129,127,125,132,125,126,131,125,125,124,129,127,130,128,123,126,
-  129,129,127,125,127,127,127,128,126,130,123,122,132,128,125,128,
-  125,130,128,126,125,126,128,126,126,131,129,127,124,127,127,128,
-  126,126,127,124,127,133,128,124,126,128,128,128,127,127,128,126,
-  127,128,128,126,127,128,128,128,126,128,125,127,125,127,126,128,
-  128,125,126,132,128,123,129,120,132,134,123,126,127,127,129,128,
-  127,127,126,125,131,126,126,125,128,127,126,127,129,126,125,127,
-  128,129,126,128,126,127,126,131,127,123,127,124,126,127,130,127,
-  126,127,130,129,126,124,128,129,127,126,124,133,125,122,129,128,
-  130,121,129,133,124,129,124,128,127,129,122,128,128,126,129,127,
-  128,127,128,125,125,132,125,125,128,125,127,127,125,128,129,129,
-  128,128,127,126,123,130,128,123,127,123,134,131,120,127,126,128,
-  128,128,126,124,128,126,131,126,124,126,125,130,129,126,130,126,
-  125,127,124,128,126,130,128,125,131,123,125,127,129,130,127,127,
-  124,130,128,131,124,125,125,126,127,129,128,126,126,126,132,127,
-  124,127,127,129,127,127,128,123,129,129,126,128,125,130,127,124,
-  128,128,127,118,132,134,125,125,124,128,130,128,125,130,126,126,
-  127,128,127,125,126,128,129,125,129,129,124,129,128,123,128,125,
-  131,126,127,128,129,127,125,126,129,125,125,128,129,127,125,129,
-  124,129,126,129,127,127,124,131,128,127,126,122,130,129,128,126,
-  125,128,125,129,129,124,126,127,129,126,129,127,126,128,129,127,
-  124,129,126,128,128,125,128,126,124,128,127,130,125,127,128,127,
-  127,126,127,125,127,130,127,130,127,121,129,127,125,124,130,128,
-  128,125,127,127,127,127,130,127,124,129,128,129,127,127,125,127,
-  127,127,127,128,125,127,127,126,128,126,129,130,123,126,127,128,
-  128,126,127,127,126,127,128,126,128,127,126,125,126,127,130,123,
-  130,127,127,130,123,125,128,133,126,127,129,126,124,128,128,125,
-  124,127,127,128,127,124,128,130,127,128,128,126,126,127,128,127,
-  128,124,128,127,129,126,127,125,124,130,126,125,125,130,127,128,
-  131,126,125,127,127,128,125,128,127,129,128,125,126,125,127,125,
-  128,130,126,124,129,129,127,127,126,127,127,126,128,129,127,126,
-  127,127,124,128,125,126,129,127,127,125,126,126,130,127,127,129,
-  129,123,128,131,125,125,130,126,126,127,126,125,130,126,126,129,
-  126,125,128,128,131,124,128,125,124,130,126,129,127,127,123,132,
-  127,122,125,128,128,123,131,129,125,129,127,129,126,130,125,126,
-  128,126,127,127,125,123,131,130,123,128,127,125,129,128,129,125,
-  126,129,127,129,126,128,125,127,127,129,128,124,130,126,124,131,
-  126,124,127,126,126,129,129,127,130,127,126,127,126,127,128,126,
-  128,128,127,127,123,130,129,122,127,130,124,128,130,129,125,127,
-  127,128,127,127,128,126,125,127,127,128,129,127,127,122,129,129,
-  126,127,129,125,127,128,128,127,128,128,123,129,125,126,127,127,
-  126,128,128,127,128,127,127,127,127,128,127,127,128,126,126,129,
-  126,126,126,127,129,126,125,124,128,126,131,126,129,123,128,131,
-  127,128,127,127,125,131,127,124,127,126,128,128,127,125,129,125,
-  125,132,126,126,125,127,127,127,132,126,124,126,127,129,127,127,
-  124,127,130,125,128,128,126,129,127,126,126,129,125,128,128,127,
-  128,128,128,126,128,125,127,126,125,130,120,131,131,124,126,126,
-  130,126,127,125,129,125,127,130,128,128,125,127,129,123,128,128,
-  127,125,126,128,131,127,126,130,126,121,130,129,126,125,129,125,
-  128,129,125,128,126,128,125,129,127,123,128,127,128,126,128,128,
-  124,131,130,127,125,128,127,129,128,127,124,127,127,125,130,129,
-  125,126,128,127,125,130,125,125,128,125,128,129,123,132,127,125,
-  129,127,127,125,128,128,126,127,124,127,128,130,127,126,128,125,
-  129,128,123,128,131,123,126,127,127,127,129,125,128,126,128,128,
-  127,129,126,127,126,126,127,125,127,128,130,125,125,130,124,127,
-  127,128,125,128,128,127,128,126,130,123,128,128,129,128,122,125,
-  129,130,125,127,129,124,128,129,126,128,127,127,128,129,125,126,
-  127,126,129,127,125,127,125,130,127,126,127,129,126,129,128,123,
-  128,125,128,126,131,125,127,127,126,127,127,128,125,126,129,127,
-  127,125,129,127,125,127,128,128,126,129,126,125,126,126,127,129,
-  127,127,126,127,128,127,128,127,124,129,129,124,127,127,129,126,
-  129,130,123,127,128,128,128,127,125,127,126,125,130,127,121,127,
-  131,130,125,127,124,128,129,127,127,127,129,124,128,129,126,126,
-  126,128,128,127,127,126,129,125,128,127,127,127,128,126,124,131,
-  131,123,128,127,128,127,126,125,127,129,125,129,126,126,126,130,
-  128,126,128,128,127,127,128,127,130,124,125,128,129,128,125,126,
-  127,126,128,128,127,127,127,125,126,130,127,125,128,129,127,129,
-  124,126,126,130,123,130,128,125,128,126,127,128,129,126,125,130,
-  128,124,129,124,127,129,129,127,126,126,127,124,128,129,125,126,
-  127,127,127,129,124,128,129,125,128,129,124,129,127,125,126,129,
-  129,124,127,127,127,129,126,126,127,127,127,127,129,126,129,124,
-  127,129,125,128,127,127,127,128,126,125,127,128,126,129,124,128,
-  128,126,127,128,127,129,125,127,130,125,126,126,127,126,128,127,
-  127,127,126,126,130,127,127,125,126,127,127,129,128,123,129,130,
-  127,127,126,127,126,130,124,128,129,126,126,126,129,128,127,127,
-  127,130,127,125,127,127,128,126,128,127,129,125,125,128,130,125,
-  126,127,128,126,127,127,126,126,124,131,128,128,128,128,125,129,
-  127,130,125,127,126,127,129,126,126,126,128,129,126,127,128,127,
-  128,127,125,126,128,125,127,129,129,126,127,127,127,127,125,130,
-  128,127,127,125,130,125,125,131,125,130,126,129,126,127,128,126,
-  128,126,126,127,126,126,128,129,127,123,130,127,126,129,126,125,
-  128,128,125,128,128,126,128,127,126,130,129,125,126,126,128,127,
-  123,129,128,127,124,132,125,126,128,125,128,129,125,125,128,129,
-  125,128,127,126,128,127,127,126,127,127,129,124,127,128,125,125,
-  129,128,125,130,128,127,128,126,126,127,128,125,127,129,125,127,
-  126,127,129,125,131,127,125,127,127,128,128,127,127,128,127,124,
-  129,126,128,126,126,127,128,127,125,127,126,128,126,126,127,128,
-  128,127,127,127,127,127,128,127,126,127,126,126,129,129,126,126,
-  127,128,126,127,127,127,128,128,127,127,127,126,129,127,126,129,
-  125,126,129,127,127,126,126,128,128,127,128,125,127,129,126,125,
-  130,127,124,127,128,128,127,127,127,126,127,128,128,124,129,126,
-  124,128,126,127,130,127,127,129,124,129,126,127,128,125,125,128,
-  127,126,129,125,127,131,125,126,127,127,127,129,126,126,127,129,
-  129,125,127,126,129,126,125,129,126,127,126,127,128,127,126,126,
-  127,129,124,129,129,125,128,125,128,129,128,125,127,128,127,127,
-  124,126,130,127,126,128,126,124,129,127,127,128,130,124,127,129,
-  126,127,127,131,123,127,128,126,128,126,126,129,127,126,131,125,
-  126,127,129,125,126,127,126,131,125,127,127,127,127,128,127,127,
-  128,126,125,129,126,127,128,126,126,127,128,130,126,129,126,126,
-  127,127,128,125,128,127,128,127,128,127,126,127,126,127,127,127,
-  126,128,128,124,128,131,126,124,130,127,125,127,127,128,129,126,
-  127,126,127,127,128,128,126,126,128,127,128,127,128,125,126,128,
-  126,126,124,130,127,126,126,127,127,127,127,127,127,127,126,128,
-  128,126,125,127,128,128,126,128,129,126,128,128,126,126,127,128,
-  126,127,127,126,128,126,127,128,126,128,127,128,127,127,127,126,
-  126,126,129,127,127,127,125,129,126,125,128,127,127,128,127,128,
-  126,126,131,124,129,126,127,128,127,127,127,125,127,127,128,125,
-  129,128,126,127,126,127,129,127,126,125,128,127,125,128,127,128,
-  126,128,126,128,128,126,128,126,125,127,129,125,129,126,126,127,
-  127,128,126,127,127,129,126,125,130,126,128,126,126,128,127,128,
-  128,127,128,127,126,127,127,127,127,127,126,127,127,129,128,124,
-  128,126,127,127,128,125,129,127,126,127,128,126,128,128,127,128,
-  126,126,129,127,127,128,125,127,128,127,127,127,127,128,126,127,
-  128,126,127,129,124,128,127,126,127,128,128,127,125,127,129,126,
-  126,127,127,127,126,127,127,127,128,128,126,126,129,127,127,127,
-  129,126,125,128,128,128,126,127,127,126,126,126,126,130,126,126,
-  128,126,128,128,127,126,129,126,127,128,127,127,128,126,125,127,
-  128,126,127,127,128,128,126,128,127,127,127,127,127,128,127,127,
-  127,126,127,127,127,127,125,129,127,125,127,128,128,125,127,128,
-  127,126,129,128,126,128,126,127,128,127,128,126,127,128,127,127,
-  125,129,127,127,127,127,126,127,127,127,127,128,127,126,129,127,
-  127,127,127,127,126,127,127,126,127,129,128,127,127,127,126,128,
-  126,128,129,125,127,128,127,126,127,127,128,126,127,128,126,126,
-  127,127,127,127,129,127,127,126,128,128,127,127,128,127,127,126,
-  126,127,127,126,129,127,124,130,128,127,127,126,126,126,128,128,
-  127,127,125,127,128,126,126,128,128,126,126,125,128,128,127,127,
-  128,124,128,128,127,125,127,129,128,125,126,127,129,126,126,126,
-  125,128,129,128,127,128,125,128,130,126,124,129,126,125,129,125,
-  128,129,128,127,127,127,126,128,127,127,126,129,126,127,126,128,
-  127,127,127,126,127,127,128,127,126,127,126,127,127,129,126,128,
-  127,126,127,129,127,127,128,126,127,125,127,128,127,126,128,128,
-  126,127,127,128,126,128,126,126,128,128,127,127,128,126,128,126,
-  127,128,128,127,127,126,127,130,125,126,129,126,125,130,127,126,
-  127,128,126,128,128,126,126,127,128,127,125,126,127,128,127,128,
-  126,125,128,128,127,126,128,125,126,129,128,128,125,127,127,127,
-  126,128,126,127,128,126,126,129,127,126,126,128,127,130,127,125,
-  127,127,129,127,125,126,128,127,128,127,127,127,126,127,127,127,
-  125,128,129,125,128,129,125,127,127,127,128,125,130,126,125,127,
-  127,127,128,128,126,127,128,128,126,126,128,126,128,128,125,128,
-  126,127,127,127,128,127,125,129,128,128,127,125,127,127,128,127,
-  127,127,127,126,129,126,127,126,127,127,127,128,127,126,127,128,
-  128,127,127,127,127,127,127,127,126,127,126,128,128,127,126,128,
-  125,128,131,125,125,125,128,128,127,127,128,127,127,126,129,127,
-  126,127,125,130,127,124,127,127,127,127,127,127,130,125,127,130,
-  126,126,127,128,125,127,127,127,127,128,126,126,129,127,127,127,
-  126,126,125,127,130,126,124,129,129,126,127,127,128,128,127,125,
-  127,127,126,127,127,127,127,127,125,128,129,126,126,126,127,128,
-  128,127,127,127,127,126,128,128,127,127,126,127,127,127,127,126,
-  127,128,127,127,127,127,128,127,127,126,127,129,126,126,128,127,
-  126,126,128,128,127,126,127,128,128,127,126,128,128,126,127,127,
-  127,128,126,127,127,128,127,126,127,127,126,126,127,127,127,127,
-  127,126,127,129,127,127,126,128,126,125,129,126,127,127,126,128,
-  129,127,127,127,126,127,127,127,126,127,127,128,126,127,127,127,
-  127,127,127,127,127,126,127,128,126,124,127,128,128,128,127,127,
-  128,127,127,126,127,128,125,128,128,127,127,127,126,128,127,125,
-  126,128,128,129,125,127,126,127,128,127,127,126,128,127,127,127,
-  127,128,127,127,128,126,126,127,127,128,128,127,126,128,126,129,
-  128,126,128,127,124,126,128,130,127,125,126,129,129,125,125,128,
-  126,126,128,127,128,127,127,127,127,128,127,127,126,127,126,127,
-  127,126,129,127,126,127,127,128,126,127,129,127,125,126,126,128,
-  127,127,127,127,126,128,129,127,127,127,127,126,126,127,128,127,
-  126,128,129,127,125,128,128,127,127,126,128,127,127,126,126,127,
-  127,126,127,127,127,127,127,126,128,129,125,128,127,126,128,128,
-  127,127,127,127,127,128,128,126,127,126,126,127,128,126,126,129,
-  127,127,127,127,129,126,126,128,127,126,126,128,128,127,127,127,
-  127,127,127,128,127,125,129,127,127,127,127,128,128,128,127,127,
-  127,126,128,128,126,126,125,128,129,126,127,127,128,126,128,127,
-  126,127,128,127,125,127,129,127,128,126,127,129,126,127,127,128,
-  127,126,126,127,127,127,127,126,127,126,128,129,126,126,128,126,
-  128,128,127,126,126,129,126,125,127,128,127,128,128,126,126,127,
-  128,127,127,126,127,128,128,127,126,128,126,127,128,127,126,127,
-  127,127,127,127,127,127,126,127,127,127,127,125,128,128,124,128,
-  127,127,126,128,127,127,126,127,128,126,127,127,127,127,127,128,
-  126,128,126,127,129,127,127,127,128,125,127,127,127,127,125,127,
-  128,127,128,127,126,127,126,129,126,127,127,127,126,127,129,127,
-  129,127,126,127,127,127,126,127,127,127,127,129,127,126,129,125,
-  126,128,128,127,126,127,127,128,126,127,127,127,127,127,127,128,
-  126,128,128,126,126,127,126,127,130,126,127,127,127,128,127,127,
-  127,127,125,127,128,126,127,127,127,126,130,126,126,126,127,128,
-  127,127,127,127,127,127,128,127,126,127,128,128,127,126,125,127,
-  129,126,128,127,127,127,127,128,127,127,127,128,126,128,127,125,
-  128,126,126,127,128,126,127,129,127,126,127,127,126,126,128,126,
-  129,128,126,126,127,129,128,126,126,127,127,127,127,126,128,128,
-  127,126,127,128,128,127,127,127,127,127,127,127,127,127,126,127,
-  128,127,127,128,126,126,127,127,127,128,129,124,126,129,128,128,
-  127,127,127,127,127,126,127,127,127,126,127,127,127,127,127,127,
-  127,126,128,127,127,127,127,127,127,128,127,127,127,127,127,127,
-  127,126,128,127,126,127,127,128,126,128,126,128,127,127,126,126,
-  129,127,126,127,127,128,127,127,127,127,127,127,128,127,126,128,
-  126,127,128,127,126,126,129,127,126,126,126,129,127,126,126,128,
-  127,127,126,127,128,127,127,126,128,128,128,127,128,126,127,128,
-  125,127,127,127,127,129,128,126,125,127,127,129,127,124,127,128,
-  128,127,127,127,127,127,127,127,126,127,126,127,127,128,127,127,
-  127,127,128,127,127,127,128,127,127,129,127,126,127,126,127,128,
-  126,128,127,127,128,127,125,125,129,127,127,127,126,127,130,126,
-  127,127,127,126,127,128,127,125,127,128,127,128,127,126,127,128,
-  127,127,127,127,127,127,126,126,130,127,125,127,128,126,127,127,
-  127,127,127,126,127,127,127,127,127,127,127,127,128,127,128,127,
-  127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,
-  127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,
-  127,127,127,127,127,127,127,127,
+  47,247,247,119,255,7,156,181,165,0,26,163,225,195,2,178,
+  41,74,225,145,164,56,186,19,77,184,20,14,145,16,8,92,
+  184,150,28,163,161,96,202,148,128,178,122,169,2,160,72,9,
+  226,0,0,16,15,130,136,145,177,112,61,42,91,184,2,193,
+  129,0,145,63,128,145,41,137,123,232,149,8,136,48,31,144,
+  130,0,137,56,218,167,89,12,129,56,138,17,201,150,137,73,
+  227,8,2,153,145,40,30,180,40,162,76,194,41,137,49,156,
+  193,7,11,146,145,8,242,130,8,194,129,73,138,144,147,33,
+  79,154,2,243,162,144,130,179,243,194,3,138,81,61,137,144,
+  145,227,163,1,74,27,194,90,128,26,136,164,210,16,194,136,
+  197,19,171,18,105,29,194,163,26,130,32,15,2,43,26,120,
+  29,177,21,45,226,131,27,19,27,11,161,183,16,124,170,18,
+  43,10,33,60,224,40,213,2,139,199,24,16,9,8,226,130,
+  58,128,154,181,164,8,153,167,25,16,193,48,60,184,147,124,
+  153,16,41,176,9,23,31,145,73,8,46,194,1,16,27,178,
+  41,210,146,129,75,226,179,16,32,15,162,146,144,145,32,233,
+  114,156,35,11,129,216,19,12,32,93,153,72,44,152,1,58,
+  208,17,136,178,106,184,162,64,26,24,244,33,45,26,177,165,
+  144,24,180,90,154,148,8,193,165,40,200,18,27,227,34,30,
+  147,8,28,72,59,140,35,30,137,148,168,165,8,195,32,152,
+  196,41,128,58,9,130,168,63,147,46,193,147,8,64,170,194,
+  16,212,163,57,138,167,8,152,64,45,8,209,3,59,138,193,
+  4,137,48,187,151,152,49,155,73,176,150,75,75,170,18,16,
+  219,35,25,232,131,25,225,49,171,4,137,34,30,59,146,12,
+  149,210,41,194,148,75,152,56,28,130,154,0,193,82,12,146,
+  40,78,138,161,131,212,1,9,160,197,130,25,75,145,91,168,
+  145,160,48,244,145,180,1,60,25,176,113,26,28,24,227,129,
+  24,9,128,88,208,0,73,137,9,88,169,144,81,28,59,211,
+  88,28,163,184,149,128,40,46,16,184,32,59,192,197,17,10,
+  16,25,242,129,178,49,27,17,141,90,192,64,140,2,24,77,
+  208,3,28,40,9,57,60,233,149,8,41,41,9,154,147,228,
+  32,46,161,1,136,211,178,163,147,145,124,10,152,165,8,209,
+  131,25,0,160,32,248,16,122,137,8,16,136,138,196,164,57,
+  26,211,24,130,172,49,89,139,104,9,139,3,26,242,128,3,
+  8,91,184,128,123,168,121,184,148,176,34,187,99,170,165,0,
+  0,153,17,42,94,26,9,56,44,192,33,61,11,65,9,45,
+  153,180,146,48,208,57,146,42,248,51,15,0,40,153,145,129,
+  138,148,8,229,89,25,137,24,193,145,18,210,16,160,137,1,
+  93,40,141,164,72,184,89,169,65,10,25,152,180,242,131,75,
+  152,161,150,26,177,72,168,24,132,11,49,174,133,74,169,40,
+  2,170,198,88,170,2,145,128,193,147,40,62,42,75,43,1,
+  26,26,8,232,97,44,210,16,25,137,194,163,145,166,178,88,
+  29,145,57,74,170,2,25,144,89,201,129,81,11,176,148,168,
+  104,42,226,48,27,137,64,202,4,27,64,202,35,15,1,25,
+  129,11,18,203,131,227,162,165,105,11,179,145,193,181,16,24,
+  25,27,183,25,194,64,168,160,151,58,43,176,129,163,196,96,
+  170,131,28,56,12,64,26,60,9,40,202,165,18,43,108,138,
+  26,17,217,167,72,169,17,152,161,161,81,171,4,177,16,153,
+  198,40,128,9,195,16,208,129,17,31,130,128,128,208,149,74,
+  61,177,40,75,184,19,11,10,56,133,13,210,49,170,16,215,
+  1,160,2,208,34,156,148,16,59,140,51,172,33,10,180,153,
+  22,156,34,169,17,63,161,168,133,168,146,73,179,31,1,193,
+  2,45,161,73,144,144,176,51,250,1,148,11,180,17,225,130,
+  8,76,160,144,4,27,27,196,32,42,193,17,144,208,104,185,
+  34,168,18,128,141,122,176,146,130,122,154,72,153,9,147,43,
+  150,185,135,43,0,138,17,153,150,9,146,24,202,149,106,10,
+  178,17,170,130,122,202,51,91,26,43,152,138,148,131,9,128,
+  183,61,41,144,42,94,242,16,24,184,178,98,138,8,147,27,
+  242,18,184,57,163,136,108,160,177,56,24,216,34,136,171,55,
+  31,136,0,128,107,168,146,41,26,8,93,168,149,42,26,161,
+  49,155,123,242,130,25,145,137,32,194,24,137,2,31,165,137,
+  146,0,128,28,5,156,147,17,212,26,130,137,162,122,169,18,
+  60,153,120,9,138,130,147,47,58,176,161,121,177,152,3,9,
+  0,75,192,137,116,12,144,147,42,25,146,170,183,104,200,17,
+  153,56,211,41,178,129,153,65,139,120,168,89,26,16,13,162,
+  16,152,162,67,159,40,40,226,9,133,139,134,169,165,41,145,
+  41,42,136,58,44,227,162,145,80,171,131,178,209,96,10,160,
+  151,25,160,144,4,13,33,155,4,44,209,129,56,28,178,164,
+  161,88,138,24,145,1,42,129,142,5,31,128,145,144,179,129,
+  194,121,154,163,4,30,56,138,211,56,184,148,136,17,184,124,
+  200,34,27,8,178,121,160,59,243,48,170,131,128,90,186,5,
+  153,129,128,33,14,211,2,136,168,135,60,152,0,136,129,193,
+  194,134,28,0,128,144,162,34,140,209,82,186,49,8,137,75,
+  194,153,5,137,214,89,9,10,130,128,154,35,163,143,148,152,
+  129,16,242,16,145,136,128,227,162,121,152,0,137,147,248,149,
+  25,24,41,136,154,150,138,3,25,185,133,161,241,82,140,145,
+  33,43,153,150,154,104,26,193,2,25,184,80,193,137,17,1,
+  185,99,140,168,151,0,26,130,60,10,162,129,30,2,44,211,
+  17,10,144,16,170,183,80,11,129,0,47,56,13,162,49,156,
+  163,40,144,8,0,25,104,157,151,26,161,16,152,146,33,143,
+  132,11,17,73,138,145,123,153,210,34,28,32,138,8,160,74,
+  212,40,176,96,11,32,153,109,138,18,27,1,170,5,139,72,
+  200,132,185,183,147,9,80,43,27,136,179,57,108,10,25,226,
+  130,41,9,153,114,138,90,169,198,130,74,137,0,152,147,9,
+  0,171,151,73,11,65,171,179,122,209,17,160,178,34,29,8,
+  93,160,128,129,195,75,0,27,176,97,42,217,133,137,129,8,
+  194,130,89,12,145,73,170,163,132,138,83,28,156,5,138,48,
+  169,132,10,88,218,18,152,1,184,166,1,155,167,8,73,40,
+  31,1,137,136,162,24,160,113,27,160,133,141,162,131,26,130,
+  74,153,94,41,29,73,192,17,137,130,45,160,49,155,166,129,
+  152,164,152,120,44,176,48,137,195,89,153,178,104,169,18,28,
+  1,139,0,167,25,128,1,43,129,79,154,131,152,9,151,137,
+  196,33,10,58,137,145,176,131,200,20,242,17,136,92,26,160,
+  178,4,30,1,153,148,27,5,154,73,128,46,137,133,44,25,
+  196,25,32,200,64,10,128,59,209,18,28,130,44,128,128,145,
+  32,156,128,150,240,33,128,44,144,147,168,123,144,42,65,157,
+  145,165,129,43,164,177,64,76,171,49,194,160,0,21,15,16,
+  136,136,179,33,172,167,161,162,180,211,131,177,41,122,168,57,
+  25,24,29,32,200,48,240,32,25,226,145,130,32,141,161,4,
+  138,18,124,154,0,73,153,49,187,147,129,192,48,136,153,83,
+  43,187,130,247,130,122,152,58,161,168,133,61,144,128,128,195,
+  24,180,139,114,27,59,146,107,170,64,176,136,50,155,65,142,
+  65,13,146,58,210,2,241,18,138,74,24,45,128,136,195,145,
+  129,40,153,34,175,6,10,25,179,107,137,32,185,163,131,25,
+  77,144,62,161,201,7,9,25,193,162,164,75,0,11,3,171,
+  134,168,196,18,139,132,10,131,219,151,57,28,129,128,152,131,
+  43,216,34,216,57,148,136,193,51,15,0,210,145,179,66,142,
+  32,176,56,242,33,154,131,10,243,56,160,24,50,159,17,44,
+  179,9,17,216,65,27,24,63,193,145,2,144,129,31,163,90,
+  26,41,154,32,136,24,241,2,43,162,180,78,176,179,34,11,
+  121,139,163,197,0,24,137,17,225,178,147,9,33,27,167,61,
+  161,226,2,42,9,75,1,185,227,132,184,2,131,139,16,51,
+  255,132,25,137,33,241,178,34,27,43,88,217,147,178,148,61,
+  8,137,72,242,0,16,152,8,72,187,133,0,160,24,72,142,
+  181,0,1,42,90,12,162,24,192,4,43,138,98,155,40,225,
+  3,138,1,176,195,18,241,34,12,48,29,160,130,42,145,227,
+  57,128,30,147,136,180,9,48,45,227,146,129,25,109,58,170,
+  32,225,49,201,130,129,78,153,164,8,162,24,40,216,147,145,
+  161,92,8,0,12,163,242,165,25,129,24,26,8,178,25,57,
+  64,159,133,168,41,165,139,97,26,160,136,35,251,163,3,155,
+  98,28,9,56,26,140,2,1,173,39,12,26,2,43,44,211,
+  146,24,146,184,123,177,42,165,144,1,76,9,153,2,180,91,
+  128,138,4,31,41,8,210,130,25,8,192,66,186,16,4,31,
+  211,16,160,8,148,192,65,185,131,76,9,160,145,133,139,88,
+  210,58,56,202,49,9,226,129,56,9,14,20,14,1,9,161,
+  161,49,60,13,18,216,88,176,90,160,56,169,48,152,122,28,
+  162,26,198,129,146,153,97,12,128,0,128,9,1,25,44,16,
+  192,125,160,8,129,168,133,28,180,40,10,150,44,40,139,50,
+  15,129,0,10,145,145,146,61,90,192,40,243,32,152,177,50,
+  141,164,24,144,16,170,5,184,89,138,114,13,16,176,16,16,
+  11,210,51,15,211,1,161,90,152,8,129,0,11,56,192,2,
+  202,135,168,18,144,60,168,131,203,7,9,177,121,168,41,19,
+  15,0,161,128,89,43,184,49,25,249,51,31,0,26,161,72,
+  46,152,18,44,168,33,58,44,25,25,140,113,169,145,181,145,
+  73,177,74,44,130,46,8,145,168,195,133,153,33,9,153,120,
+  169,228,18,10,0,74,192,0,178,34,14,32,9,234,151,8,
+  8,0,136,144,0,211,40,128,154,131,196,16,208,66,61,44,
+  128,43,213,129,40,169,50,29,25,128,60,196,145,40,62,168,
+  18,59,168,121,59,168,106,192,17,9,226,2,60,176,147,57,
+  137,75,0,45,24,225,145,164,121,138,144,131,168,18,153,124,
+  154,18,137,72,154,24,123,153,2,41,202,150,25,0,42,160,
+  194,34,154,90,93,138,146,0,42,185,115,10,184,20,139,129,
+  64,60,140,88,152,241,19,139,88,138,146,152,18,186,34,121,
+  140,129,149,27,145,88,27,11,148,241,2,8,208,20,140,147,
+  10,132,138,17,152,137,164,128,40,212,56,168,48,157,162,22,
+  158,151,25,25,146,11,131,168,48,15,132,170,49,25,153,49,
+  12,40,139,120,216,17,195,74,176,164,24,161,56,63,44,227,
+  128,34,156,18,9,136,128,120,29,136,0,145,42,197,25,197,
+  129,0,26,178,0,178,194,18,128,43,56,202,112,44,136,137,
+  146,167,59,24,209,48,57,47,137,32,225,24,56,45,41,26,
+  193,64,155,34,155,133,11,182,128,129,56,94,154,179,65,186,
+  32,146,139,122,193,130,58,184,167,57,200,132,8,138,49,46,
+  128,137,194,149,192,3,59,152,41,168,99,47,208,34,185,148,
+  105,28,161,56,138,1,152,144,161,151,41,27,163,154,131,36,
+  175,50,184,129,146,88,143,18,10,40,74,138,46,164,129,45,
+  128,0,43,146,161,47,72,240,17,136,128,144,130,12,164,56,
+  46,8,211,24,129,153,18,138,2,155,114,13,0,128,60,194,
+  164,24,128,60,73,62,208,130,129,192,33,137,193,80,137,57,
+  171,151,137,146,166,59,24,9,0,58,169,244,1,146,139,114,
+  139,16,192,5,140,147,161,16,88,141,32,26,160,2,91,27,
+  177,18,140,49,43,77,185,181,164,146,160,181,32,184,121,10,
+  24,212,144,131,144,76,136,24,128,123,11,177,148,161,147,144,
+  79,144,73,169,179,32,138,112,139,49,140,17,185,133,153,72,
+  75,128,45,210,16,144,128,147,154,146,124,44,0,128,40,47,
+  145,144,10,133,154,50,241,40,26,56,140,17,144,12,5,12,
+  3,31,1,43,136,163,202,37,27,76,42,137,9,151,75,232,
+  132,152,146,32,46,136,0,144,24,9,210,2,137,4,47,152,
+  128,182,56,170,131,178,161,18,47,0,0,141,133,45,0,137,
+  181,8,130,42,28,213,17,59,176,32,139,151,9,145,146,62,
+  210,1,152,2,152,106,137,129,10,179,244,3,61,152,24,136,
+  179,160,3,137,57,241,148,9,1,137,42,165,91,144,137,196,
+  1,161,137,183,0,178,162,149,59,232,82,139,177,20,13,1,
+  152,1,8,193,17,241,148,60,144,146,210,211,65,140,130,40,
+  10,25,0,170,166,145,24,0,153,74,148,24,47,161,209,19,
+  45,0,152,105,28,152,164,128,179,162,129,26,163,61,44,132,
+  9,209,128,20,15,146,16,27,107,137,8,178,164,128,89,9,
+  12,182,72,44,128,8,248,3,8,43,145,176,50,79,168,160,
+  133,168,65,61,170,165,145,17,169,32,242,56,152,130,29,146,
+  8,8,123,152,42,197,145,2,28,8,211,18,170,196,17,160,
+  33,29,57,192,0,182,90,10,180,9,213,1,128,8,0,240,
+  34,140,2,136,128,128,123,152,136,163,193,121,8,10,144,162,
+  130,76,144,41,137,49,47,58,184,64,218,5,139,18,9,57,
+  44,168,57,211,32,162,31,129,168,5,154,50,31,0,9,192,
+  20,29,56,185,32,208,120,153,17,10,25,129,154,132,136,25,
+  199,41,148,140,132,137,162,179,48,249,82,140,162,17,138,1,
+  136,24,163,158,135,27,145,17,138,132,12,163,25,8,144,120,
+  171,134,58,61,160,57,0,139,225,151,26,146,24,74,12,130,
+  25,9,227,16,128,192,4,170,4,155,115,139,144,180,145,18,
+  202,114,29,128,161,16,26,178,18,186,149,9,121,11,162,32,
+  10,137,113,29,211,16,136,128,129,201,114,154,147,24,61,152,
+  136,4,140,17,168,133,138,96,171,133,152,73,9,168,104,8,
+  12,34,47,160,32,10,40,201,149,128,146,29,148,137,3,30,
+  74,153,147,25,41,11,48,42,245,40,128,137,2,47,145,42,
+  210,17,192,65,141,82,12,24,144,41,177,90,169,65,138,194,
+  82,141,17,152,144,146,176,149,0,122,13,130,9,0,178,32,
+  29,129,26,243,104,154,17,136,177,2,152,177,21,172,5,44,
+  16,13,163,176,131,209,36,156,2,9,145,108,192,17,8,75,
+  176,41,162,25,147,139,179,73,42,215,8,97,141,146,130,136,
+  9,136,150,61,161,25,144,2,138,215,1,0,9,72,203,50,
+  91,139,16,210,17,155,6,11,24,179,78,40,13,162,0,129,
+  152,123,152,145,80,13,0,160,51,143,1,25,128,144,162,128,
+  57,63,178,59,211,0,8,163,62,144,76,179,27,134,28,24,
+  136,57,224,130,162,24,74,217,150,9,1,152,25,195,57,8,
+  161,224,166,40,0,45,128,201,134,136,24,152,2,154,165,74,
+  26,147,10,184,135,61,177,40,16,11,32,140,195,89,241,33,
+  138,34,248,48,155,81,169,40,145,25,91,9,45,129,40,140,
+  179,67,15,163,60,176,2,0,42,8,90,44,12,164,41,162,
+  16,156,167,24,241,131,24,11,112,29,24,192,148,136,40,128,
+  75,152,16,45,0,138,196,17,193,145,4,186,149,107,137,24,
+  144,1,139,132,169,97,43,75,240,147,176,51,187,163,150,58,
+  59,209,0,73,153,177,98,217,32,57,169,17,26,243,32,168,
+  1,9,163,28,126,136,176,34,153,9,80,61,186,21,184,129,
+  2,142,2,56,44,59,242,129,41,160,196,1,8,146,201,83,
+  30,144,130,168,130,129,60,136,168,4,185,167,25,72,138,129,
+  8,208,166,73,42,176,105,202,151,8,8,16,27,243,130,153,
+  149,8,24,44,129,29,147,9,0,24,184,146,0,8,120,47,
+  144,128,195,40,209,17,128,59,106,12,177,19,155,5,26,193,
+  178,162,56,24,91,79,153,146,144,18,61,168,90,48,159,19,
+  185,130,58,163,44,178,215,88,27,160,72,209,16,136,1,138,
+  17,75,27,129,24,155,113,45,9,161,165,176,52,157,48,26,
+  44,161,148,60,176,8,146,167,193,17,24,43,30,165,152,196,
+  18,138,40,40,249,34,138,137,113,28,160,48,153,210,132,136,
+  42,0,10,161,3,185,130,132,45,242,18,203,135,24,153,24,
+  162,25,160,167,25,56,10,62,209,48,153,18,154,81,31,136,
+  180,48,13,48,171,4,28,32,138,64,155,147,43,195,26,149,
+  128,145,78,152,161,180,65,250,20,28,8,42,194,1,75,208,
+  2,128,160,24,48,143,18,59,225,1,145,200,4,59,10,17,
+  10,57,95,170,164,146,197,40,176,163,32,170,147,130,40,79,
+  241,129,128,64,171,18,210,73,9,137,196,146,57,152,178,165,
+  76,177,48,12,0,56,63,10,178,136,148,145,108,10,162,161,
+  72,9,153,182,56,11,165,108,27,145,129,75,144,8,9,129,
+  209,147,92,152,195,32,168,130,241,147,88,14,17,184,2,136,
+  41,144,24,225,48,16,156,80,201,18,169,35,187,150,73,137,
+  107,26,168,18,152,48,14,0,26,108,193,194,147,195,163,9,
+  104,170,105,24,10,41,8,138,179,211,147,125,152,25,1,216,
+  17,24,225,18,11,1,44,178,136,49,11,76,148,171,18,58,
+  245,0,1,137,144,98,189,6,26,25,144,129,10,131,12,128,
+  33,225,129,17,15,164,24,8,176,131,10,122,177,160,64,208,
+  17,59,129,249,3,192,81,171,18,153,199,16,145,152,2,27,
+  131,63,216,18,160,162,48,233,147,24,42,74,193,176,151,74,
+  169,132,9,129,137,130,140,33,57,240,161,21,171,148,0,45,
+  179,178,73,152,123,200,149,8,193,131,92,10,40,26,59,136,
+  178,130,136,164,95,192,145,17,41,29,162,9,17,168,182,56,
+  152,9,121,152,90,28,161,195,49,138,208,165,162,41,129,91,
+  139,149,9,58,213,0,128,56,172,36,139,144,198,129,24,162,
+  8,16,155,163,121,10,193,97,12,16,59,184,148,90,153,129,
+  136,183,57,41,46,161,130,137,32,155,196,34,10,42,224,148,
+  160,17,41,216,165,49,15,0,8,176,134,10,144,180,33,155,
+  148,26,122,59,185,150,128,128,8,40,154,88,26,42,26,247,
+  17,153,164,0,177,146,73,43,27,144,151,75,193,16,75,193,
+  88,11,177,48,144,162,108,137,24,136,243,2,152,210,50,31,
+  8,0,137,32,216,133,27,145,129,42,24,42,128,41,9,253,
+  151,25,145,1,46,128,8,8,177,148,176,35,140,56,110,200,
+  33,137,144,147,137,179,123,152,41,16,10,209,146,128,40,146,
+  177,241,113,155,56,193,178,4,160,40,109,154,163,168,135,27,
+  180,129,137,146,48,11,144,146,232,116,14,179,16,60,128,74,
+  138,32,169,129,48,171,146,52,15,40,153,243,2,128,185,151,
+  144,72,27,1,46,136,0,0,9,214,16,58,153,145,181,129,
+  168,164,64,171,4,59,28,0,0,246,17,137,41,107,153,130,
+  136,193,130,128,162,154,53,26,31,0,40,29,0,161,9,131,
+  79,137,144,145,128,32,162,242,163,9,90,42,194,137,167,56,
+  75,156,6,45,136,16,10,41,144,144,40,229,161,18,57,30,
+  8,8,144,123,161,25,42,179,9,41,215,0,0,129,44,128,
+  137,73,160,132,12,105,153,178,130,40,11,124,200,148,136,131,
+  26,136,176,21,31,145,24,152,64,27,43,199,129,0,25,153,
+  33,177,153,120,136,193,40,193,181,90,152,229,33,184,32,138,
+  3,27,32,13,145,145,163,74,227,124,169,165,16,137,40,184,
+  149,42,40,11,1,25,160,79,160,9,149,129,170,133,152,129,
+  144,33,13,131,244,57,177,1,44,196,24,25,148,30,0,177,
+  195,34,28,128,73,154,72,192,144,34,10,211,105,153,144,64,
+  43,152,128,0,129,64,143,56,160,122,11,180,136,148,162,44,
+  2,170,2,24,123,142,150,25,41,152,8,145,88,153,42,0,
+  10,209,115,186,33,8,137,161,17,192,33,8,61,45,42,57,
+  240,113,186,212,20,12,0,128,8,136,179,136,130,25,194,57,
+  17,45,26,122,186,179,3,181,25,148,171,21,154,122,170,133,
+  225,19,44,26,24,60,152,146,128,176,112,139,162,130,74,129,
+  9,169,125,184,179,135,44,8,0,153,146,180,25,88,184,180,
+  24,74,74,185,198,16,1,10,90,41,13,8,17,153,8,167,
+  42,24,9,208,4,26,74,170,132,248,5,138,40,144,57,138,
+  16,169,49,241,131,76,200,163,164,0,144,26,211,32,161,90,
+  60,58,138,123,152,184,135,136,24,58,208,1,161,163,41,161,
+  93,42,184,164,90,40,29,128,136,161,66,59,252,132,137,131,
+  168,1,8,195,107,8,9,42,8,24,45,144,195,5,31,0,
+  160,129,24,160,163,169,34,247,147,40,30,49,13,161,40,152,
+  57,24,201,36,27,168,24,162,242,147,211,161,121,138,64,10,
+  211,24,24,59,57,217,145,162,36,173,5,137,8,144,18,155,
+  130,79,10,163,176,1,167,40,240,34,140,164,8,136,180,32,
+  139,3,244,145,89,42,137,123,169,17,176,133,42,25,58,12,
+  145,129,186,23,45,136,130,176,48,58,45,43,56,249,165,89,
+  154,129,32,152,195,8,24,160,131,137,127,200,18,43,129,27,
+  16,137,177,73,40,193,240,133,9,177,17,144,129,79,27,0,
+  41,144,161,128,32,138,243,80,12,24,211,152,165,181,210,19,
+  10,136,122,154,129,1,153,180,120,138,24,8,196,25,32,10,
+  59,212,1,41,138,72,44,144,1,184,227,146,121,79,168,129,
+  145,144,162,33,137,42,242,2,153,17,195,73,219,134,137,162,
+  2,43,25,91,201,132,144,1,108,152,25,24,152,58,168,135,
+  11,146,122,11,178,3,94,138,146,144,1,9,59,49,141,177,
+  133,61,242,1,8,177,146,1,41,27,10,177,20,244,72,28,
+  0,42,144,161,229,2,128,29,2,27,210,18,26,9,1,29,
+  144,164,58,123,153,17,75,217,163,163,197,129,8,0,10,164,
+  160,165,41,0,91,155,1,49,12,42,162,162,111,200,2,177,
+  19,31,0,136,42,153,151,61,130,28,41,144,128,226,18,138,
+  16,144,160,198,130,8,160,123,242,130,128,137,17,75,138,64,
+  169,130,9,145,245,16,145,26,128,130,9,200,114,170,19,42,
+  31,56,62,168,146,16,176,121,169,195,18,160,9,193,20,12,
+  129,32,47,177,2,77,153,32,208,130,16,138,129,128,211,227,
+  18,43,136,16,171,20,107,46,144,16,41,29,211,0,128,129,
+  8,10,167,152,16,48,250,4,10,25,89,45,144,136,147,136,
+  64,187,131,194,147,243,56,242,16,144,128,136,122,136,128,74,
+  41,29,8,178,8,34,30,128,161,43,212,34,200,129,128,123,
+  152,160,183,88,59,43,26,160,162,16,137,20,251,150,24,138,
+  2,59,176,147,122,200,129,146,93,136,106,11,145,1,138,3,
+  44,152,146,144,129,245,17,138,148,90,137,144,24,193,34,30,
+  8,194,165,25,0,144,0,201,167,145,0,145,42,57,139,34,
+  176,128,128,181,60,11,39,142,17,43,8,130,138,192,151,90,
+  12,163,144,72,152,209,50,141,165,42,129,136,160,18,240,164,
+  74,9,179,56,63,10,177,72,152,212,65,12,128,16,138,33,
+  224,129,195,72,27,25,145,137,66,63,184,179,19,217,18,137,
+  45,165,41,170,151,0,209,17,26,72,31,128,145,40,153,197,
+  16,160,16,89,28,8,24,9,160,105,10,161,16,49,47,11,
+  129,193,131,161,162,42,58,8,108,240,51,158,148,25,24,160,
+  144,1,1,140,148,145,225,33,11,124,137,0,128,128,128,57,
+  208,57,130,76,225,2,11,17,27,160,181,33,61,41,138,176,
+  128,151,8,125,138,146,16,25,139,215,163,1,9,176,131,226,
+  132,26,25,178,153,150,74,25,42,75,184,180,57,244,163,24,
+  24,26,72,141,181,162,32,25,152,145,42,8,8,60,120,249,
+  163,1,209,148,25,160,131,41,140,166,0,44,145,128,16,44,
+  193,50,47,137,32,152,60,227,0,0,42,8,130,14,165,8,
+  211,73,8,43,152,136,112,11,178,132,169,182,17,137,194,57,
+  210,1,1,60,137,8,32,11,200,3,8,127,185,19,224,18,
+  169,149,58,27,162,210,18,10,125,137,128,25,128,16,169,167,
+  128,128,25,160,98,169,128,90,59,242,17,169,130,194,33,140,
+  130,128,182,160,4,138,162,176,72,184,151,126,137,144,128,130,
+  136,58,193,48,184,168,7,9,241,131,168,34,201,17,227,128,
+  73,145,25,76,210,90,138,179,18,137,8,74,137,89,28,57,
+  137,152,130,179,59,75,120,45,153,50,12,193,177,20,169,4,
+  28,16,76,139,132,9,193,179,34,184,176,115,15,179,121,153,
+  1,42,160,24,145,28,34,42,173,6,153,194,65,9,45,8,
+  57,27,210,80,154,56,89,187,3,195,27,148,145,8,59,128,
+  95,225,18,28,128,177,182,24,0,0,27,130,12,195,3,62,
+  26,8,145,124,136,153,130,145,128,168,183,145,1,40,170,51,
+  200,128,128,128,62,123,160,90,61,228,8,130,136,145,144,164,
+  25,123,185,131,0,136,214,33,139,17,44,8,24,11,166,8,
+  137,73,213,73,160,128,1,185,3,42,8,8,95,176,128,33,
+  168,128,176,135,9,42,8,184,36,11,128,181,184,116,13,146,
+  137,3,170,50,192,123,184,130,32,29,32,186,131,11,132,128,
+  208,115,11,74,156,167,0,57,160,8,42,8,59,64,31,128,
+  128,128,176,67,191,21,8,137,162,176,51,63,152,8,90,186,
+  66,32,15,8,162,160,148,8,56,11,243,40,40,176,123,91,
+  169,147,46,34,172,65,216,32,137,146,145,128,32,11,59,75,
+  184,151,42,32,30,180,27,80,10,128,90,194,8,168,32,179,
+  123,194,91,144,152,163,160,56,192,131,128,208,23,47,152,130,
+  136,128,16,208,145,40,210,96,138,128,211,32,153,72,152,8,
+  8,72,235,151,8,24,8,137,160,133,11,122,176,1,177,163,
+  41,178,62,180,194,49,29,24,169,32,128,184,180,23,141,179,
+  3,170,112,155,19,42,208,40,162,168,66,184,123,43,145,59,
+  8,8,8,61,128,240,5,63,9,41,9,25,194,1,8,56,
+  63,27,180,8,242,130,128,75,161,162,58,123,27,128,25,181,
+  179,42,8,59,128,112,187,199,33,152,25,32,29,128,128,32,
+  62,192,40,42,199,0,24,9,8,60,210,1,152,183,8,17,
+  137,128,128,179,59,4,188,123,212,146,128,16,137,32,62,201,
+  165,24,161,49,171,130,138,183,149,10,49,217,16,8,168,134,
+  153,33,176,128,128,128,128,62,180,48,143,130,32,243,89,9,
+  137,128,176,131,192,3,8,136,224,151,8,8,56,139,128,128,
+  224,151,42,40,60,76,137,137,167,25,16,137,128,128,179,108,
+  27,162,10,167,9,104,154,48,10,42,162,184,7,152,193,18,
+  47,8,72,185,57,64,204,19,144,8,8,8,59,60,48,12,
+  8,180,8,197,96,171,162,50,63,137,162,13,151,8,25,212,
+  129,136,1,169,19,25,170,51,12,8,8,13,151,60,177,1,
+  8,184,132,128,128,128,182,179,8,8,8,8,8,8,8,8,
+  8,128,8,128,128,128,128,8,8,8,9,0,127,127,127,255,
+  135,91,200,65,28,177,2,200,148,162,61,8,88,47,8,176,
+  164,0,40,75,184,64,29,128,8,176,4,57,30,209,132,136,
+  8,40,59,156,67,138,8,137,107,16,25,188,199,132,9,58,
+  58,90,12,16,61,25,144,144,17,28,176,3,178,18,15,88,
+  185,179,34,192,128,24,40,241,165,73,169,211,49,201,149,128,
+  44,211,17,75,185,133,8,59,177,56,44,176,211,18,216,150,
+  41,59,144,144,89,138,162,122,28,145,1,9,176,35,79,27,
+  73,45,41,9,25,25,41,169,182,1,176,212,164,32,160,25,
+  76,160,146,8,193,131,74,31,32,136,184,34,233,166,24,128,
+  128,160,178,197,20,14,195,2,60,9,41,58,216,146,17,240,
+  164,0,24,177,57,137,32,201,129,130,129,249,4,144,161,48,
+  47,161,160,123,138,165,40,26,152,18,240,180,3,45,160,129,
+  73,154,16,144,179,241,20,10,25,136,122,25,154,72,60,184,
+  130,112,29,161,0,24,243,16,26,210,130,41,136,180,24,208,
+  19,29,128,8,40,137,24,66,157,146,27,165,130,187,151,211,
+  17,58,176,16,156,131,18,187,6,25,77,138,128,3,9,31,
+  212,18,27,144,17,78,155,148,48,29,144,91,128,193,129,16,
+  160,160,104,26,128,25,74,43,129,29,59,183,8,57,242,131,
+  26,11,134,9,26,0,108,10,193,34,42,13,56,138,3,29,
+  105,10,160,0,144,182,144,227,165,145,16,184,133,137,160,148,
+  128,160,129,48,209,177,64,176,162,152,112,160,25,123,153,130,
+  0,63,160,145,74,160,196,146,144,131,168,41,199,146,58,58,
+  144,0,29,76,144,227,145,181,163,128,91,24,152,27,128,182,
+  1,168,149,32,31,136,130,74,170,147,96,27,185,149,145,209,
+  195,3,161,128,123,43,128,208,80,169,130,74,10,129,144,123,
+  208,2,42,209,163,56,170,183,130,9,229,17,137,128,130,26,
+  192,166,0,144,161,179,147,59,42,161,198,24,90,74,140,146,
+  17,169,229,162,164,162,145,24,145,16,139,16,1,250,179,120,
+  144,192,33,8,243,16,10,227,18,29,178,148,9,209,148,40,
+  169,147,72,61,138,129,56,155,129,41,181,25,129,123,10,211,
+  64,11,192,165,0,176,166,40,226,129,24,160,145,64,12,180,
+  40,27,215,1,8,176,3,42,137,163,25,226,193,167,129,25,
+  136,179,18,139,16,105,157,19,79,26,136,41,8,161,0,153,
+  131,107,12,162,166,177,180,129,16,185,129,65,138,194,19,72,
+  47,29,145,129,136,160,183,33,138,129,40,169,192,166,146,214,
+  129,144,130,9,177,18,137,72,93,43,137,16,93,11,146,40,
+  224,2,107,153,178,17,208,181,17,11,183,129,41,168,148,8,
+  26,163,90,27,136,50,47,12,146,48,46,168,3,90,156,131,
+  57,170,199,32,25,192,17,74,137,0,61,25,128,9,57,10,
+  88,31,144,148,9,145,144,180,227,129,145,211,179,72,8,41,
+  46,24,160,168,165,145,129,209,32,72,59,156,132,153,243,35,
+  12,161,1,42,10,242,35,45,9,24,9,129,208,1,91,241,
+  18,76,26,152,89,43,242,130,137,164,129,25,144,129,26,216,
+  166,34,47,137,1,8,184,148,145,210,179,104,60,152,144,16,
+  178,198,57,42,8,92,28,145,129,168,2,32,76,12,129,91,
+  168,196,1,136,145,123,26,145,161,57,216,166,0,144,129,9,
+  25,162,197,1,41,45,57,78,168,195,56,153,214,130,24,9,
+  8,41,9,0,145,93,170,166,1,184,181,148,42,176,132,41,
+  155,167,73,138,162,1,9,144,178,66,47,176,18,44,160,227,
+  131,26,179,92,137,147,44,16,184,179,56,43,197,73,44,226,
+  164,161,129,32,92,29,161,130,168,197,130,144,0,25,32,137,
+  241,180,146,145,24,73,45,184,166,129,177,147,56,63,44,161,
+  194,211,163,146,16,59,59,74,27,209,3,9,192,32,95,152,
+  177,18,10,196,73,59,25,25,202,183,165,136,179,1,58,185,
+  166,17,224,130,0,153,130,144,40,242,162,146,129,88,46,25,
+  193,161,2,243,163,24,168,133,43,184,151,73,12,162,33,29,
+  193,131,41,200,163,104,44,160,162,56,176,178,194,132,128,136,
+  8,243,3,45,8,58,60,9,128,161,194,4,62,61,24,11,
+  16,41,200,167,24,57,44,44,144,178,3,60,185,67,46,42,
+  59,160,17,155,183,35,79,12,130,42,184,165,17,27,210,48,
+  61,208,130,24,136,179,122,61,9,25,9,178,164,161,73,136,
+  24,26,242,164,161,211,148,24,10,129,107,138,212,147,41,152,
+  48,63,10,129,137,211,131,74,44,25,58,10,210,179,198,130,
+  9,145,1,59,200,199,163,145,129,122,43,25,10,178,146,210,
+  34,61,75,43,9,128,193,147,138,150,73,61,137,161,145,196,
+  180,17,138,1,91,153,197,1,26,145,72,79,10,145,24,153,
+  181,130,25,136,9,2,154,165,33,31,194,179,80,139,179,48,
+  187,150,56,28,193,33,59,242,17,138,212,130,25,161,32,61,
+  27,145,0,227,195,196,130,24,58,77,138,0,24,152,164,73,
+  60,153,56,9,241,180,130,59,104,62,9,152,8,179,228,2,
+  58,10,24,25,25,241,130,8,168,114,44,137,1,154,183,146,
+  40,137,0,92,169,165,0,193,130,90,75,43,59,168,196,146,
+  16,25,136,109,59,200,182,146,144,146,90,26,8,25,176,182,
+  130,8,168,96,62,137,146,24,168,16,107,60,26,41,42,138,
+  180,147,8,168,120,45,144,163,8,244,146,0,8,9,0,41,
+  11,18,248,132,93,138,146,0,136,144,197,129,129,74,11,129,
+  9,33,46,226,164,8,129,168,64,169,180,122,11,164,1,27,
+  194,3,63,176,17,59,241,2,75,9,160,1,26,228,163,129,
+  161,129,75,60,136,177,147,243,148,74,11,146,89,13,196,130,
+  8,144,122,43,152,32,11,195,165,41,25,136,24,10,162,177,
+  35,137,128,77,125,44,160,146,129,169,148,130,62,24,27,58,
+  25,144,129,248,67,28,59,58,201,147,64,217,4,78,10,178,
+  16,152,212,163,162,1,74,46,160,146,89,153,16,90,11,0,
+  25,25,89,13,56,9,123,27,25,243,179,129,195,130,42,42,
+  160,122,26,209,147,25,194,2,42,9,41,45,227,1,25,144,
+  16,77,58,26,58,45,42,40,202,98,62,10,144,146,128,226,
+  2,226,146,73,168,162,0,41,185,7,75,27,40,169,226,148,
+  129,136,161,106,128,91,12,146,40,43,144,88,45,9,17,14,
+  211,163,128,212,130,56,28,41,153,227,131,42,152,49,79,43,
+  10,1,192,17,152,72,93,27,194,161,164,195,162,72,10,105,
+  44,153,165,128,144,162,32,9,8,42,139,167,145,57,122,44,
+  42,9,8,193,180,2,26,123,42,60,10,144,229,180,130,8,
+  144,16,75,138,162,213,162,32,41,26,10,40,10,227,180,148,
+  123,27,24,26,144,211,163,178,162,82,47,42,9,8,161,129,
+  162,192,19,44,192,132,176,179,199,17,41,61,76,10,40,26,
+  25,192,180,104,27,24,136,136,16,243,179,180,57,136,137,88,
+  224,147,144,162,16,41,79,176,180,178,178,182,164,56,44,26,
+  40,45,136,146,9,210,1,123,9,160,180,161,181,162,128,132,
+  60,10,210,164,227,163,146,136,32,78,138,147,137,211,164,0,
+  8,74,25,201,166,0,160,130,123,59,10,24,168,197,163,128,
+  163,75,8,128,11,199,146,16,59,109,59,138,129,177,164,161,
+  162,34,46,59,160,177,183,211,18,26,8,168,80,169,195,195,
+  148,128,25,9,80,218,147,213,163,0,42,161,72,44,10,56,
+  26,8,61,58,193,179,152,199,164,8,129,106,43,168,146,152,
+  198,148,9,161,2,59,138,147,161,43,247,164,1,10,194,18,
+  62,152,129,41,9,177,123,25,193,17,44,212,178,17,136,194,
+  32,137,65,13,160,148,56,28,42,40,30,129,144,177,149,160,
+  145,104,152,200,19,225,212,130,0,136,8,161,146,210,179,182,
+  146,58,25,146,170,72,137,164,41,56,127,28,177,33,42,200,
+  211,49,44,144,41,42,193,129,9,199,147,91,43,144,176,82,
+  170,165,74,137,17,93,10,193,2,26,194,2,43,152,130,74,
+  137,194,120,185,164,48,44,184,195,3,8,154,5,45,8,26,
+  17,176,57,47,129,26,176,167,130,140,149,128,90,185,165,40,
+  193,180,16,25,160,145,106,193,178,130,74,136,242,72,184,183,
+  162,146,24,24,60,137,73,9,241,2,26,129,74,43,10,195,
+  24,226,132,42,152,57,152,147,242,214,130,41,42,25,108,10,
+  144,0,144,1,58,28,1,154,152,183,18,241,130,108,137,145,
+  128,8,243,147,58,25,136,25,26,210,167,41,168,3,91,28,
+  161,130,58,155,35,76,45,24,9,137,198,1,137,180,16,8,
+  60,226,163,128,145,153,167,130,26,9,196,163,41,16,9,142,
+  19,78,168,194,132,9,8,24,41,10,73,46,128,0,108,28,
+  161,178,17,160,213,17,137,0,48,31,177,131,91,139,165,16,
+  28,194,163,72,26,153,17,59,152,144,129,210,112,46,41,161,
+  8,75,144,25,176,131,121,171,182,148,25,128,152,89,10,1,
+  25,169,197,147,60,0,128,26,11,183,198,17,26,138,4,42,
+  60,138,197,130,75,26,16,155,197,147,162,242,164,32,44,137,
+  1,136,209,148,90,59,9,58,61,136,9,40,209,131,78,43,
+  161,162,176,167,129,26,16,58,93,27,176,149,128,210,147,74,
+  10,161,88,27,136,1,139,49,56,47,169,149,152,163,16,140,
+  133,123,45,8,144,8,210,34,28,161,48,45,42,153,0,165,
+  136,58,242,147,210,163,32,154,179,121,28,162,128,176,167,32,
+  138,211,33,59,139,19,13,145,16,43,192,80,8,75,11,161,
+  49,95,43,152,88,12,146,58,200,148,32,13,1,128,26,128,
+  243,146,130,42,240,2,24,216,211,51,13,145,0,41,242,146,
+  40,139,183,32,26,136,145,106,28,129,57,28,128,25,48,142,
+  147,0,45,243,130,8,176,148,16,28,33,30,160,3,60,9,
+  8,57,139,74,25,245,164,40,153,178,1,193,3,75,217,65,
+  91,44,9,25,128,210,195,130,161,1,43,105,168,57,111,27,
+  161,32,28,129,137,2,185,151,73,155,131,90,27,177,130,160,
+  243,132,91,10,8,24,8,153,148,193,145,164,16,168,215,2,
+  26,160,147,40,44,152,122,9,152,65,30,41,152,17,75,169,
+  1,25,105,29,161,129,177,64,74,63,160,8,91,25,161,41,
+  137,212,0,72,200,146,146,138,166,1,10,130,11,105,154,4,
+  26,152,176,133,42,229,72,10,168,19,144,177,40,95,153,130,
+  57,170,3,27,232,36,200,0,178,40,59,198,16,169,82,31,
+  145,0,152,8,17,152,16,10,200,215,65,27,194,129,74,153,
+  17,61,242,130,41,25,137,0,129,139,144,199,164,16,177,8,
+  144,151,43,177,164,24,10,164,97,46,168,48,138,161,16,1,
+  153,40,111,153,161,211,131,8,161,153,20,28,8,1,169,247,
+  131,25,144,178,56,45,144,179,91,177,56,76,26,42,177,108,
+  176,147,41,75,242,2,139,228,165,40,9,8,41,26,41,26,
+  229,162,1,25,145,128,240,181,1,160,2,57,31,0,25,160,
+  211,18,155,147,72,59,26,27,245,163,0,178,40,41,29,178,
+  163,196,227,17,168,165,106,26,193,146,194,147,145,25,0,92,
+  44,152,80,138,162,57,61,9,176,32,212,0,211,145,147,8,
+  153,121,10,194,146,162,34,31,74,42,76,43,152,162,129,153,
+  4,211,8,144,72,242,1,160,16,91,44,25,178,129,185,151,
+  24,57,138,1,77,169,182,145,194,3,59,153,58,151,26,185,
+  151,129,107,26,176,179,162,196,130,210,131,42,78,137,32,153,
+  32,28,144,131,61,77,137,129,152,130,123,176,0,40,184,128,
+  195,166,144,49,30,161,48,13,136,196,130,128,209,148,129,10,
+  145,0,16,184,125,137,8,130,57,11,242,1,129,124,27,41,
+  136,161,90,168,179,180,130,107,136,26,176,150,75,25,9,17,
+  61,200,147,128,0,138,82,63,27,25,211,130,208,165,160,3,
+  58,9,41,234,148,163,144,1,44,25,9,227,3,208,164,0,
+  90,11,40,41,169,152,54,142,130,25,42,153,56,199,130,168,
+  74,160,183,73,184,163,228,18,43,9,226,180,64,138,194,129,
+  2,10,8,160,180,48,140,19,45,145,45,0,136,226,3,137,
+  88,45,137,32,59,201,213,18,43,176,97,28,8,8,209,149,
+  57,45,144,8,24,144,24,208,34,59,139,180,0,210,183,56,
+  137,161,56,10,196,0,26,197,96,47,8,41,26,168,131,128,
+  176,129,195,148,12,198,180,163,8,0,90,44,144,24,176,163,
+  17,91,60,26,75,137,196,178,180,130,153,64,60,160,41,136,
+  183,24,58,26,24,77,13,167,161,145,163,144,122,138,146,129,
+  0,185,36,62,9,79,137,194,130,161,1,10,32,43,73,31,
+  145,32,154,73,73,61,43,153,129,178,149,41,168,18,15,129,
+  162,211,161,166,16,26,8,179,92,155,167,129,41,92,26,136,
+  176,147,89,169,165,144,88,169,179,18,11,178,1,192,196,162,
+  130,194,163,17,184,151,169,212,4,43,136,105,192,128,32,168,
+  121,43,9,8,0,29,181,1,169,147,104,29,145,16,91,186,
+  150,128,128,144,25,32,208,128,183,33,46,41,137,162,128,160,
+  132,170,151,122,10,25,136,129,8,144,130,26,58,60,136,243,
+  180,2,26,160,105,77,27,177,180,180,18,138,9,20,63,139,
+  165,128,152,131,24,9,146,47,128,242,130,73,138,128,105,27,
+  144,177,183,129,145,24,8,1,138,128,128,128,128,128,128,128,
+  128,177,
 };
-const int SAMPLE_LEN = 11864;
+const int SAMPLE_LEN = 8898;
+const AdpcmState sampleCheckpoints[] = {
+  {0, 0, 0},
+  {8351, 74, 0},
+  {-12896, 79, 0},
+  {-6694, 78, 0},
+  {-17831, 85, 0},
+  {-1296, 80, 0},
+  {-3217, 73, 0},
+  {-755, 77, 0},
+  {3400, 80, 0},
+  {-4695, 74, 0},
+  {-6141, 75, 0},
+  {9198, 76, 0},
+  {-6180, 76, 0},
+  {1609, 66, 0},
+  {6497, 63, 0},
+  {-4679, 70, 0},
+  {8804, 73, 0},
+  {-746, 80, 0},
+  {591, 75, 0},
+  {825, 71, 0},
+  {-120, 67, 0},
+  {-2064, 70, 0},
+  {903, 61, 0},
+  {-740, 58, 0},
+  {-431, 68, 0},
+  {508, 64, 0},
+  {818, 66, 0},
+  {192, 66, 0},
+  {-1342, 64, 0},
+  {-486, 61, 0},
+  {845, 63, 0},
+  {-1160, 55, 0},
+  {1405, 63, 0},
+  {453, 56, 0},
+  {-68, 49, 0},
+  {229, 52, 0},
+  {-548, 53, 0},
+  {320, 54, 0},
+  {282, 47, 0},
+  {219, 50, 0},
+  {-542, 50, 0},
+  {-251, 46, 0},
+  {28, 44, 0},
+  {64, 45, 0},
+  {-102, 49, 0},
+  {-10, 46, 0},
+  {-589, 54, 0},
+  {0, 0, 0},
+  {-8705, 78, 0},
+  {-2653, 72, 0},
+  {2224, 71, 0},
+  {-3141, 71, 0},
+  {-3441, 71, 0},
+  {1553, 76, 0},
+  {5818, 75, 0},
+  {2460, 73, 0},
+  {1686, 70, 0},
+  {-241, 63, 0},
+  {1209, 58, 0},
+  {-717, 60, 0},
+  {1196, 61, 0},
+  {-869, 49, 0},
+  {-354, 52, 0},
+  {-286, 55, 0},
+  {-269, 53, 0},
+  {-352, 41, 0},
+  {180, 44, 0},
+  {-384, 45, 0},
+  {-217, 38, 0},
+  {-134, 38, 0},
+  {33, 44, 0},
+};
+const SampleInfo sampleInfo[] = {
+  {{{0, 11864, 0}, {5932, 5932, 47}}, 2, 44100, 31488}, // 909_oh.wav, 13.5/13.2 dB SNR
+};
+const int SAMPLE_COUNT = 1;
+const SampleBank sampleBank = {sampleData, sampleCheckpoints, sampleInfo, SAMPLE_COUNT};
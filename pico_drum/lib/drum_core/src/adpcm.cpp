@@ -0,0 +1,122 @@
+#include "adpcm.h"
+
+#include <string.h>
+
+static const int16_t stepTable[89] = {
+    7,     8,     9,     10,    11,    12,    13,    14,    16,    17,
+    19,    21,    23,    25,    28,    31,    34,    37,    41,    45,
+    50,    55,    60,    66,    73,    80,    88,    97,    107,   118,
+    130,   143,   157,   173,   190,   209,   230,   253,   279,   307,
+    337,   371,   408,   449,   494,   544,   598,   658,   724,   796,
+    876,   963,   1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+    2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,
+    5894,  6484,  7132,  7845,  8630,  9493,  10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767};
+
+static const int8_t indexTable[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+void adpcmStart(AdpcmDecoder &d, const uint8_t *data,
+                const AdpcmState *checkpoints)
+{
+  d.data = data;
+  d.checkpoints = checkpoints;
+  d.base = 0;
+  d.have = 0;
+  d.next = 0;
+  d.predictor = 0;
+  d.index = 0;
+  for (int i = 0; i < 4; i++)
+  {
+    d.hist[i] = 0;
+  }
+}
+
+// Restart from the checkpoint at or before sample `at`
+static void seek(AdpcmDecoder &d, uint32_t at)
+{
+  uint32_t c = at / ADPCM_CHECKPOINT;
+  d.next = c * ADPCM_CHECKPOINT;
+  d.have = 0; // elsewhere in the stream: back to flash
+  d.predictor = d.checkpoints[c].predictor;
+  d.index = d.checkpoints[c].index;
+  for (int i = 0; i < 4; i++)
+  {
+    d.hist[i] = 0; // overwritten by the run-up, or silence before sample 0
+  }
+}
+
+void adpcmAdvance(AdpcmDecoder &d, uint32_t end)
+{
+  // Behind us, or more than a checkpoint interval ahead: jump (keeping
+  // four samples of run-up for hist)
+  uint32_t from = (end >= 4) ? end - 4 : 0;
+  if (end < d.next || end - d.next > ADPCM_CHECKPOINT)
+  {
+    seek(d, from);
+  }
+
+  // From the window if it holds everything up to `end`
+  if (d.have != 0 && end > d.next && ((end - 1) >> 1) >= d.base + d.have)
+  {
+    d.have = 0;
+  }
+  const uint8_t *src = (d.have != 0) ? d.ahead : d.data;
+  uint32_t base = (d.have != 0) ? d.base : 0;
+
+  int32_t pred = d.predictor;
+  int32_t index = d.index;
+  int32_t h0 = d.hist[0], h1 = d.hist[1], h2 = d.hist[2];
+  uint32_t n = d.next;
+  while (n < end)
+  {
+    uint8_t nibble = (src[(n >> 1) - base] >> ((n & 1) << 2)) & 0x0F;
+
+    int32_t step = stepTable[index];
+    int32_t diff = step >> 3;
+    if (nibble & 4) diff += step;
+    if (nibble & 2) diff += step >> 1;
+    if (nibble & 1) diff += step >> 2;
+    h0 = h1;
+    h1 = h2;
+    h2 = pred;
+    pred += (nibble & 8) ? -diff : diff;
+    if (pred > 32767) pred = 32767;
+    if (pred < -32768) pred = -32768;
+
+    index += indexTable[nibble & 7];
+    if (index < 0) index = 0;
+    if (index > 88) index = 88;
+    n++;
+  }
+  d.predictor = pred;
+  d.index = index;
+  d.hist[0] = (int16_t)h0;
+  d.hist[1] = (int16_t)h1;
+  d.hist[2] = (int16_t)h2;
+  d.hist[3] = (int16_t)pred;
+  d.next = n;
+}
+
+void adpcmReadAhead(AdpcmDecoder &d, uint32_t end, uint32_t len)
+{
+  if (end <= d.next || end - d.next > ADPCM_CHECKPOINT)
+  {
+    return; // nothing to decode, or adpcmAdvance() will jump
+  }
+  uint32_t first = d.next >> 1;
+  uint32_t last = (end - 1) >> 1;
+  if (d.have != 0 && first >= d.base && last < d.base + d.have)
+  {
+    return;
+  }
+
+  uint32_t n = (len + 1) / 2 - first;
+  if (n > ADPCM_AHEAD) n = ADPCM_AHEAD;
+  if (last - first >= n)
+  {
+    return;
+  }
+  memcpy(d.ahead, d.data + first, n);
+  d.base = first;
+  d.have = n;
+}
@@ -0,0 +1,56 @@
+#ifndef ADPCM_H
+#define ADPCM_H
+
+#include <stdint.h>
+
+// ── IMA-ADPCM streaming decoder ─────────────────────────────
+// Samples are stored as 4-bit IMA-ADPCM (two per byte, low nibble first)
+// and decoded to 16 bits on the fly while a voice plays. Every
+// ADPCM_CHECKPOINT samples the converter also stores the decoder state, so
+// a voice can jump to any position by decoding at most one checkpoint
+// interval instead of the whole sample.
+//
+// The stream is read in place from flash (XIP). adpcmReadAhead() copies
+// the bytes a block is about to decode into a small per-decoder RAM
+// window, so the per-nibble loop never waits on an XIP cache miss and
+// other code running from flash can't evict the data mid-block.
+
+#define ADPCM_CHECKPOINT 256 // samples between seek checkpoints
+#define ADPCM_AHEAD 64       // bytes of read-ahead: 128 samples
+
+// Decoder state before decoding a checkpoint's first sample
+struct AdpcmState
+{
+  int16_t predictor;
+  uint8_t index; // step table index, 0..88
+  uint8_t reserved;
+};
+
+struct AdpcmDecoder
+{
+  const uint8_t *data; // in flash
+  const AdpcmState *checkpoints;
+  uint32_t base;       // ahead[] holds data[base … base + have)
+  uint32_t have;       // 0: no window, decode straight from data
+  uint8_t ahead[ADPCM_AHEAD];
+  uint32_t next;     // index of the next sample to decode
+  int32_t predictor; // = last
+  int32_t index;
+  int16_t hist[4];   // samples next - 4 … next - 1 (0 before the start)
+};
+
+void adpcmStart(AdpcmDecoder &d, const uint8_t *data,
+                const AdpcmState *checkpoints);
+
+// Continue until `next == end`: samples end - 4 … end - 1 are then in
+// hist. Jumps through a checkpoint when `end` is behind or far ahead.
+// Reads the RAM window while it covers the bytes, flash otherwise.
+void adpcmAdvance(AdpcmDecoder &d, uint32_t end);
+
+// About to decode up to sample `end` of a `len`-sample stream: unless the
+// window already covers those bytes, refill it from the next undecoded
+// byte (as far as ADPCM_AHEAD and the stream allow). Does nothing when
+// the range wouldn't fit or needs a checkpoint jump first.
+void adpcmReadAhead(AdpcmDecoder &d, uint32_t end, uint32_t len);
+
+#endif // ADPCM_H
@@ -0,0 +1,39 @@
+#ifndef AUDIO_H
+#define AUDIO_H
+
+#include <stdint.h>
+
+// ── Block audio output ──────────────────────────────────────
+// PWM on one pin, clocked so its wrap rate is the sample rate. Two DMA
+// channels chained into a ping-pong feed the PWM compare register on every
+// wrap (DREQ), so samples leave at an exact, jitter-free rate no matter
+// what the CPU is doing. One interrupt per AUDIO_BLOCK samples refills the
+// block that just finished playing by calling the render callback.
+
+#define AUDIO_BLOCK 32 // samples per block (0.73 ms at 44.1 kHz)
+
+// Fill `count` signed 16-bit samples. Runs in the DMA interrupt: it must
+// finish within one block period.
+typedef void (*AudioRender)(int16_t *out, int count);
+
+// Start output. The achieved rate is the nearest one the system clock
+// divides into (see audioSampleRateMilliHz).
+void audioBegin(uint8_t pin, uint32_t sampleRateHz, AudioRender render);
+
+// Actual sample rate in mHz, e.g. 44098101 for 44.1 kHz at 133 MHz.
+uint32_t audioSampleRateMilliHz();
+
+// Index of the first sample of the block being rendered; valid inside the
+// render callback. Sample 0 is the first one played after audioBegin().
+uint64_t audioRenderPosition();
+
+// Output sample that leaves the PWM at or right after timer time `us`
+// (time_us_64()), and the timer time at which sample `n` leaves.
+uint64_t audioSampleAt(uint64_t us);
+uint64_t audioTimeOf(uint64_t n);
+
+// PWM counts per sample period (the output resolution, ~3000 = 11.6 bits
+// at 133 MHz).
+uint32_t audioPwmRange();
+
+#endif // AUDIO_H
@@ -0,0 +1,143 @@
+#if defined(ARDUINO_ARCH_RP2040)
+
+#include "audio.h"
+
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/pwm.h"
+#include "hardware/timer.h"
+
+// Compare-register words, one buffer per DMA channel. The word sets both
+// channels of the slice; the one we don't drive is held at 0.
+static uint32_t blocks[2][AUDIO_BLOCK];
+static int16_t renderBuf[AUDIO_BLOCK];
+static int dmaChan[2];
+
+static AudioRender renderFn = nullptr;
+static uint32_t pwmRange = 0;  // PWM counts per sample (wrap + 1)
+static uint32_t levelShift = 0; // 0 for channel A, 16 for channel B
+static uint32_t rateMilliHz = 0;
+static uint64_t startUs = 0;   // timer time of sample 0
+static bool anchored = false;  // startUs measured on the first block's end
+static uint64_t renderPos = 0; // first sample of the block being rendered
+
+// Render one block and convert it to compare values for our PWM channel.
+static void fillBlock(uint32_t *dst)
+{
+  renderFn(renderBuf, AUDIO_BLOCK);
+  renderPos += AUDIO_BLOCK;
+  for (int i = 0; i < AUDIO_BLOCK; i++)
+  {
+    uint32_t level = ((uint32_t)(renderBuf[i] + 32768) * pwmRange) >> 16;
+    dst[i] = level << levelShift;
+  }
+}
+
+// Sample 0's time, from the end of the first block. The last transfer of a
+// block happens on a PWM wrap (DREQ) and the compare register latches it on
+// the next wrap, so sample AUDIO_BLOCK - 1 leaves one period after this
+// interrupt (less its entry latency, well under a µs). The time taken in
+// audioBegin() before the DMA start is 1-2 periods early: the first
+// transfer waits for a wrap and its value for the one after.
+static void anchorStart()
+{
+  uint64_t now = time_us_64();
+  startUs = now - (uint64_t)(AUDIO_BLOCK - 2) * 1000000000u / rateMilliHz;
+  anchored = true;
+}
+
+// A channel finished its block: the other one is already playing, so rewind
+// this one and refill its buffer before the other one runs out.
+static void onDmaBlock()
+{
+  for (int b = 0; b < 2; b++)
+  {
+    if (dma_channel_get_irq0_status(dmaChan[b]))
+    {
+      if (!anchored)
+      {
+        anchorStart();
+      }
+      dma_channel_acknowledge_irq0(dmaChan[b]);
+      dma_channel_set_read_addr(dmaChan[b], blocks[b], false);
+      fillBlock(blocks[b]);
+    }
+  }
+}
+
+void audioBegin(uint8_t pin, uint32_t sampleRateHz, AudioRender render)
+{
+  renderFn = render;
+
+  // Sample period in system clocks, at divider 1 for the best resolution:
+  // the rate error is below 0.5 / period, e.g. 45 ppm at 133 MHz.
+  uint32_t sysHz = clock_get_hz(clk_sys);
+  pwmRange = (sysHz + sampleRateHz / 2) / sampleRateHz;
+  rateMilliHz = (uint32_t)((uint64_t)sysHz * 1000 / pwmRange);
+
+  uint slice = pwm_gpio_to_slice_num(pin);
+  levelShift = (pwm_gpio_to_channel(pin) == PWM_CHAN_B) ? 16 : 0;
+  gpio_set_function(pin, GPIO_FUNC_PWM);
+  pwm_config cfg = pwm_get_default_config();
+  pwm_config_set_clkdiv_int(&cfg, 1);
+  pwm_config_set_wrap(&cfg, pwmRange - 1);
+  pwm_init(slice, &cfg, false);
+  pwm_set_gpio_level(pin, pwmRange / 2);
+
+  // Ping-pong: each channel plays one block, then triggers the other
+  dmaChan[0] = dma_claim_unused_channel(true);
+  dmaChan[1] = dma_claim_unused_channel(true);
+  for (int b = 0; b < 2; b++)
+  {
+    dma_channel_config c = dma_channel_get_default_config(dmaChan[b]);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, pwm_get_dreq(slice));
+    channel_config_set_chain_to(&c, dmaChan[b ^ 1]);
+    dma_channel_configure(dmaChan[b], &c, &pwm_hw->slice[slice].cc,
+                          blocks[b], AUDIO_BLOCK, false);
+    dma_channel_set_irq0_enabled(dmaChan[b], true);
+    fillBlock(blocks[b]);
+  }
+
+  irq_add_shared_handler(DMA_IRQ_0, onDmaBlock,
+                         PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+  irq_set_enabled(DMA_IRQ_0, true);
+
+  pwm_set_enabled(slice, true);
+  startUs = time_us_64(); // estimate until the first block ends
+  anchored = false;
+  dma_channel_start(dmaChan[0]);
+}
+
+uint32_t audioSampleRateMilliHz() { return rateMilliHz; }
+
+uint64_t audioRenderPosition() { return renderPos; }
+
+uint64_t audioSampleAt(uint64_t us)
+{
+  if (us <= startUs)
+  {
+    return 0;
+  }
+  // Whole seconds and the rest separately, so nothing overflows in the
+  // module's lifetime. Rounds up: the first sample not before `us`.
+  uint64_t d = us - startUs;
+  uint64_t secMilli = (d / 1000000) * rateMilliHz; // samples × 1000
+  uint64_t partMilli = (d % 1000000) * rateMilliHz; // samples × 1e9
+  return secMilli / 1000 +
+         ((secMilli % 1000) * 1000000 + partMilli + 999999999u) / 1000000000u;
+}
+
+uint64_t audioTimeOf(uint64_t n)
+{
+  uint64_t sec = n * 1000 / rateMilliHz;
+  uint64_t rest = n * 1000 - sec * rateMilliHz; // < rateMilliHz
+  return startUs + sec * 1000000 + rest * 1000000 / rateMilliHz;
+}
+
+uint32_t audioPwmRange() { return pwmRange; }
+
+#endif // ARDUINO_ARCH_RP2040
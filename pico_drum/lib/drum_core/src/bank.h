@@ -0,0 +1,45 @@
+#ifndef BANK_H
+#define BANK_H
+
+#include <stdint.h>
+
+#include "adpcm.h"
+
+// ── Sample bank ─────────────────────────────────────────────
+// All sounds of a kit live back to back in one IMA-ADPCM byte array in
+// flash, with their seek checkpoints in a second table; this index says
+// where each one starts and how to play it. Generated by wav_converter.py
+// into sample_data.h.
+//
+// Every sound is stored as a few mipmap levels: level 0 is the sample
+// itself, level k is level k - 1 low-pass filtered and decimated by 2.
+// Played faster than its own rate, a voice reads the level that keeps its
+// content below the output Nyquist frequency instead of aliasing.
+
+#define BANK_UNITY_GAIN 32768 // Q15 1.0
+#define BANK_MAX_LEVELS 4     // mipmap levels per sample: up to 8x pitch
+
+struct SampleLevel
+{
+  uint32_t offset;     // first byte in the ADPCM array
+  uint32_t length;     // samples at this level
+  uint32_t checkpoint; // first entry in the checkpoint table
+};
+
+struct SampleInfo
+{
+  SampleLevel level[BANK_MAX_LEVELS];
+  uint32_t levels;   // levels present, at least 1
+  uint32_t rootRate; // Hz: level 0 plays at this rate at unity pitch
+  uint16_t gain;     // Q15 level; samples are stored peak-normalised
+};
+
+struct SampleBank
+{
+  const uint8_t *data;
+  const AdpcmState *checkpoints;
+  const SampleInfo *samples;
+  uint32_t count;
+};
+
+#endif // BANK_H
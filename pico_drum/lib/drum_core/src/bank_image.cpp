@@ -0,0 +1,147 @@
+#include "bank_image.h"
+
+#include <stddef.h>
+#include <string.h>
+
+// The image stores these structs verbatim
+static_assert(sizeof(AdpcmState) == 4, "AdpcmState layout");
+static_assert(sizeof(SampleLevel) == 12, "SampleLevel layout");
+static_assert(sizeof(SampleInfo) == 60, "SampleInfo layout");
+static_assert(offsetof(SampleInfo, levels) == 48, "SampleInfo layout");
+static_assert(sizeof(BankImageHeader) == 44, "BankImageHeader layout");
+
+uint32_t bankImageCrc(const uint8_t *data, uint32_t len)
+{
+  // CRC-32 (zlib's), a nibble at a time: small table, fast enough at boot
+  static const uint32_t table[16] = {
+      0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4,
+      0x4DB26158, 0x5005713C, 0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+      0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C};
+  uint32_t crc = 0xFFFFFFFF;
+  for (uint32_t i = 0; i < len; i++)
+  {
+    crc ^= data[i];
+    crc = (crc >> 4) ^ table[crc & 0x0F];
+    crc = (crc >> 4) ^ table[crc & 0x0F];
+  }
+  return ~crc;
+}
+
+// [offset, offset + count * unit) inside [0, size), without overflow
+static bool inside(uint32_t offset, uint32_t count, uint32_t unit,
+                   uint32_t size)
+{
+  return offset <= size && count <= (size - offset) / unit;
+}
+
+// Every level reads only its own bytes and checkpoints, and is long enough
+// for the voice's level-k position (pos >> k) to stay inside it
+static bool sampleValid(const SampleInfo &s, const BankImageHeader &h)
+{
+  if (s.levels < 1 || s.levels > BANK_MAX_LEVELS || s.rootRate == 0)
+  {
+    return false;
+  }
+  // Q16.16 read position
+  if (s.level[0].length == 0 || s.level[0].length > 0xFFFF)
+  {
+    return false;
+  }
+  for (uint32_t k = 0; k < s.levels; k++)
+  {
+    const SampleLevel &l = s.level[k];
+    uint32_t need = (s.level[0].length + (1u << k) - 1) >> k;
+    uint32_t checkpoints = (l.length + ADPCM_CHECKPOINT - 1) / ADPCM_CHECKPOINT;
+    if (l.length < need || !inside(l.offset, (l.length + 1) / 2, 1, h.dataSize) ||
+        !inside(l.checkpoint, checkpoints, 1, h.checkpointCount))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+BankImageStatus bankImageOpen(const uint8_t *image, uint32_t size,
+                              SampleBank &bank)
+{
+  BankImageHeader h;
+  if (size < sizeof(h))
+  {
+    return BANK_IMAGE_TRUNCATED;
+  }
+  memcpy(&h, image, sizeof(h));
+  if (h.magic != BANK_IMAGE_MAGIC)
+  {
+    return BANK_IMAGE_NONE;
+  }
+  if (h.version != BANK_IMAGE_VERSION)
+  {
+    return BANK_IMAGE_VERSION_MISMATCH;
+  }
+  if (h.size < sizeof(h) || h.size > size ||
+      ((h.infoOffset | h.checkpointOffset | h.dataOffset) & 3) != 0 ||
+      !inside(h.infoOffset, h.count, sizeof(SampleInfo), h.size) ||
+      !inside(h.nameOffset, h.count, BANK_IMAGE_NAME, h.size) ||
+      !inside(h.checkpointOffset, h.checkpointCount, sizeof(AdpcmState),
+              h.size) ||
+      !inside(h.dataOffset, h.dataSize, 1, h.size))
+  {
+    return BANK_IMAGE_TRUNCATED;
+  }
+  if (bankImageCrc(image + sizeof(h), h.size - sizeof(h)) != h.crc)
+  {
+    return BANK_IMAGE_BAD_CRC;
+  }
+
+  // The decoder indexes its step table with these
+  const AdpcmState *checkpoints =
+      (const AdpcmState *)(image + h.checkpointOffset);
+  for (uint32_t i = 0; i < h.checkpointCount; i++)
+  {
+    if (checkpoints[i].index > 88)
+    {
+      return BANK_IMAGE_BAD_SAMPLE;
+    }
+  }
+
+  // The sample pot picks slot pot * count / 4096: with no entries that is
+  // slot 0, past the end of the table
+  if (h.count == 0)
+  {
+    return BANK_IMAGE_BAD_SAMPLE;
+  }
+  const SampleInfo *samples = (const SampleInfo *)(image + h.infoOffset);
+  for (uint32_t i = 0; i < h.count; i++)
+  {
+    if (!sampleValid(samples[i], h))
+    {
+      return BANK_IMAGE_BAD_SAMPLE;
+    }
+  }
+
+  bank.data = image + h.dataOffset;
+  bank.checkpoints = checkpoints;
+  bank.samples = samples;
+  bank.count = h.count;
+  return BANK_IMAGE_OK;
+}
+
+const char *bankImageStatusName(BankImageStatus status)
+{
+  switch (status)
+  {
+  case BANK_IMAGE_OK:
+    return "ok";
+  case BANK_IMAGE_NONE:
+    return "no image";
+  case BANK_IMAGE_VERSION_MISMATCH:
+    return "unsupported version";
+  case BANK_IMAGE_TRUNCATED:
+    return "truncated";
+  case BANK_IMAGE_BAD_CRC:
+    return "bad CRC";
+  case BANK_IMAGE_BAD_SAMPLE:
+    return "bad sample entry";
+  }
+  return "?";
+}
@@ -0,0 +1,67 @@
+#ifndef BANK_IMAGE_H
+#define BANK_IMAGE_H
+
+#include <stdint.h>
+
+#include "bank.h"
+
+// ── Bank image ──────────────────────────────────────────────
+// A kit as one flat, position-independent blob, built by wav_converter.py
+// and flashed on its own into a reserved region at the end of flash (the
+// core's filesystem region, see platformio.ini), so changing samples
+// doesn't mean rebuilding the firmware. The tables are laid out exactly
+// like the structs in bank.h: once validated, the SampleBank points
+// straight into flash (XIP) without copying anything.
+//
+//   BankImageHeader
+//   SampleInfo[count]        infoOffset
+//   char[count][16] names    nameOffset (NUL-padded, for tools)
+//   AdpcmState[...]          checkpointOffset
+//   uint8_t[...] ADPCM       dataOffset
+//
+// All offsets are from the start of the image and 4-byte aligned; the
+// image is padded to whole flash sectors. Little-endian throughout.
+
+#define BANK_IMAGE_MAGIC 0x4B424450u // "PDBK"
+#define BANK_IMAGE_VERSION 1
+#define BANK_IMAGE_SECTOR 4096
+#define BANK_IMAGE_NAME 16
+
+struct BankImageHeader
+{
+  uint32_t magic;
+  uint32_t version;
+  uint32_t size; // bytes used, header included (before sector padding)
+  uint32_t crc;  // CRC-32 of the bytes after the header, up to size
+  uint32_t count;
+  uint32_t infoOffset;
+  uint32_t nameOffset;
+  uint32_t checkpointOffset;
+  uint32_t checkpointCount;
+  uint32_t dataOffset;
+  uint32_t dataSize;
+};
+
+enum BankImageStatus
+{
+  BANK_IMAGE_OK,
+  BANK_IMAGE_NONE,     // no magic: nothing flashed (or erased)
+  BANK_IMAGE_VERSION_MISMATCH,
+  BANK_IMAGE_TRUNCATED, // larger than the region, or tables out of bounds
+  BANK_IMAGE_BAD_CRC,
+  BANK_IMAGE_BAD_SAMPLE // an entry would read outside its tables
+};
+
+// Validate the image at `image` (at most `size` bytes available) and
+// point `bank` into it.
+BankImageStatus bankImageOpen(const uint8_t *image, uint32_t size,
+                              SampleBank &bank);
+
+const char *bankImageStatusName(BankImageStatus status);
+
+uint32_t bankImageCrc(const uint8_t *data, uint32_t len);
+
+// The image in the reserved flash region (RP2040 only).
+BankImageStatus bankImageFlash(SampleBank &bank);
+
+#endif // BANK_IMAGE_H
@@ -0,0 +1,31 @@
+#if defined(ARDUINO_ARCH_RP2040)
+
+#include <Arduino.h>
+
+#include "bank_image.h"
+#include "hardware/regs/addressmap.h"
+
+// The core's filesystem region (board_build.filesystem_size), used here
+// as a raw bank image instead of LittleFS
+extern uint8_t _FS_start;
+extern uint8_t _FS_end;
+
+BankImageStatus bankImageFlash(SampleBank &bank)
+{
+  const uint8_t *region = &_FS_start;
+  uint32_t size = (uint32_t)(&_FS_end - &_FS_start);
+  BankImageStatus status = bankImageOpen(region, size, bank);
+  if (status != BANK_IMAGE_OK)
+  {
+    return status;
+  }
+
+  // Stream the ADPCM through the non-allocating XIP alias: voices copy it
+  // into their read-ahead windows in bursts anyway, and this way it never
+  // evicts code (or the tables) from the 16 KB XIP cache
+  bank.data = (const uint8_t *)((uintptr_t)bank.data - XIP_BASE +
+                                XIP_NOCACHE_NOALLOC_BASE);
+  return BANK_IMAGE_OK;
+}
+
+#endif // ARDUINO_ARCH_RP2040
@@ -0,0 +1,20 @@
+#include "cv.h"
+
+void cvInit(CvFilter &f)
+{
+  f.acc = -1;
+}
+
+int cvFilter(CvFilter &f, int raw)
+{
+  int32_t x = (int32_t)raw << CV_SMOOTH_SHIFT;
+  if (f.acc < 0)
+  {
+    f.acc = x; // start at the first reading, not from 0
+  }
+  else
+  {
+    f.acc += (x - f.acc) >> CV_SMOOTH_SHIFT;
+  }
+  return (f.acc + (1 << (CV_SMOOTH_SHIFT - 1))) >> CV_SMOOTH_SHIFT;
+}
@@ -0,0 +1,23 @@
+#ifndef CV_H
+#define CV_H
+
+#include <stdint.h>
+
+// ── CV smoothing ────────────────────────────────────────────
+// One-pole low-pass for 12-bit pot/CV readings taken at the control rate.
+// Keeps CV_SMOOTH_SHIFT fraction bits, so it settles to within one LSB of
+// the input. Time constant: 2^CV_SMOOTH_SHIFT control ticks (8 ms at 1 kHz).
+
+#define CV_SMOOTH_SHIFT 3
+
+struct CvFilter
+{
+  int32_t acc; // reading << CV_SMOOTH_SHIFT, -1 until the first one
+};
+
+void cvInit(CvFilter &f);
+
+// Feed one reading, returns the smoothed 12-bit value.
+int cvFilter(CvFilter &f, int raw);
+
+#endif // CV_H
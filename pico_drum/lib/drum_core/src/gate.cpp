@@ -0,0 +1,44 @@
+#include "gate.h"
+
+#include <atomic>
+
+static uint64_t edges[GATE_QUEUE];
+static std::atomic<uint32_t> head{0}; // written by the producer
+static std::atomic<uint32_t> tail{0}; // written by the consumer
+static std::atomic<uint32_t> dropped{0};
+
+void gatePush(uint64_t us)
+{
+  uint32_t h = head.load(std::memory_order_relaxed);
+  if (h - tail.load(std::memory_order_acquire) >= GATE_QUEUE)
+  {
+    // Only the producer writes it: no read-modify-write atomics needed
+    dropped.store(dropped.load(std::memory_order_relaxed) + 1,
+                  std::memory_order_relaxed);
+    return;
+  }
+  edges[h % GATE_QUEUE] = us;
+  head.store(h + 1, std::memory_order_release);
+}
+
+bool gatePeek(uint64_t &us)
+{
+  uint32_t t = tail.load(std::memory_order_relaxed);
+  if (t == head.load(std::memory_order_acquire))
+  {
+    return false;
+  }
+  us = edges[t % GATE_QUEUE];
+  return true;
+}
+
+void gatePop()
+{
+  tail.store(tail.load(std::memory_order_relaxed) + 1,
+             std::memory_order_release);
+}
+
+uint32_t gateDropped()
+{
+  return dropped.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,35 @@
+#ifndef GATE_H
+#define GATE_H
+
+#include <stdint.h>
+
+#include "audio.h"
+
+// ── Gate input ──────────────────────────────────────────────
+// Rising edges are caught by a GPIO interrupt and time-stamped with the
+// 1 MHz hardware timer. The audio renderer takes them from a small
+// single-producer/single-consumer queue and starts each hit at the output
+// sample GATE_LATENCY_SAMPLES after its edge. That latency is constant, so
+// hits don't jitter with where the edge fell in the block cycle.
+//
+// With double-buffered blocks an edge can only be rendered into a block
+// that starts up to two blocks later: GATE_LATENCY_SAMPLES below that gives
+// lower latency but late edges start at the block start (with jitter).
+
+#define GATE_QUEUE 8 // edges in flight, power of two
+#define GATE_LATENCY_SAMPLES (2 * AUDIO_BLOCK)
+
+// Enable the rising-edge interrupt on `pin` (RP2040 only).
+void gateBegin(uint8_t pin);
+
+// Producer (edge interrupt): queue an edge time. Drops it when full.
+void gatePush(uint64_t us);
+
+// Consumer (renderer): oldest queued edge, if any, and remove it.
+bool gatePeek(uint64_t &us);
+void gatePop();
+
+// Edges dropped because the queue was full
+uint32_t gateDropped();
+
+#endif // GATE_H
@@ -0,0 +1,18 @@
+#if defined(ARDUINO_ARCH_RP2040)
+
+#include <Arduino.h>
+
+#include "gate.h"
+#include "hardware/timer.h"
+
+static void onGateEdge()
+{
+  gatePush(time_us_64());
+}
+
+void gateBegin(uint8_t pin)
+{
+  attachInterrupt(digitalPinToInterrupt(pin), onGateEdge, RISING);
+}
+
+#endif // ARDUINO_ARCH_RP2040
@@ -0,0 +1,29 @@
+#include "latency.h"
+
+void latencyReset(LatencyHistogram &h)
+{
+  for (int i = 0; i < LATENCY_BINS; i++)
+  {
+    h.bins[i] = 0;
+  }
+  h.over = 0;
+  h.count = 0;
+  h.minUs = 0xFFFFFFFFu;
+  h.maxUs = 0;
+}
+
+void latencyRecord(LatencyHistogram &h, uint32_t us)
+{
+  uint32_t bin = us / LATENCY_BIN_US;
+  if (bin < LATENCY_BINS)
+  {
+    h.bins[bin]++;
+  }
+  else
+  {
+    h.over++;
+  }
+  h.count++;
+  h.minUs = (us < h.minUs) ? us : h.minUs;
+  h.maxUs = (us > h.maxUs) ? us : h.maxUs;
+}
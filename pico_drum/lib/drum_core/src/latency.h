@@ -0,0 +1,30 @@
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include <stdint.h>
+
+// ── Trigger latency histogram ───────────────────────────────
+// Time from a gate edge's timestamp to the output time of the sample its
+// hit was started on, in LATENCY_BIN_US wide bins. This is the scheduling
+// latency: a hit rendered in time lands at GATE_LATENCY_SAMPLES (1.45 ms)
+// plus under a sample of rounding, and only late hits show more. The delay
+// from the electrical edge to the GPIO interrupt that stamps it is not in
+// it. Written by the audio renderer, read (and printed) from the main loop;
+// a count read mid-update is off by one at most.
+
+#define LATENCY_BIN_US 8
+#define LATENCY_BINS 256 // up to 2048 µs, beyond goes to `over`
+
+struct LatencyHistogram
+{
+  uint32_t bins[LATENCY_BINS];
+  uint32_t over;
+  uint32_t count;
+  uint32_t minUs;
+  uint32_t maxUs;
+};
+
+void latencyReset(LatencyHistogram &h);
+void latencyRecord(LatencyHistogram &h, uint32_t us);
+
+#endif // LATENCY_H
@@ -0,0 +1,32 @@
+#include "params.h"
+
+void paramsPublish(ParamSnapshot &s, const Params &p)
+{
+  uint32_t seq = s.seq.load(std::memory_order_relaxed);
+  s.seq.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  s.step.store(p.step, std::memory_order_relaxed);
+  s.decay.store(p.decay, std::memory_order_relaxed);
+  s.slot.store(p.slot, std::memory_order_relaxed);
+  s.seq.store(seq + 2, std::memory_order_release);
+}
+
+bool paramsRead(const ParamSnapshot &s, Params &p)
+{
+  uint32_t before = s.seq.load(std::memory_order_acquire);
+  if (before == 0 || (before & 1))
+  {
+    return false;
+  }
+  Params copy;
+  copy.step = s.step.load(std::memory_order_relaxed);
+  copy.decay = s.decay.load(std::memory_order_relaxed);
+  copy.slot = s.slot.load(std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (s.seq.load(std::memory_order_relaxed) != before)
+  {
+    return false;
+  }
+  p = copy;
+  return true;
+}
@@ -0,0 +1,36 @@
+#ifndef PARAMS_H
+#define PARAMS_H
+
+#include <atomic>
+#include <stdint.h>
+
+// ── Control → audio parameter handoff ───────────────────────
+// Core0 scans the pots at the control rate and publishes one consistent
+// set of playback parameters; the audio renderer on core1 picks it up once
+// per block. Single writer, sequence-counted (seqlock): the writer never
+// waits, and the reader makes one attempt per block and keeps its previous
+// values if it caught the writer mid-update. Nobody masks interrupts.
+
+struct Params
+{
+  uint32_t step;  // Q16.16 pitch
+  uint32_t decay; // Q31 envelope factor
+  uint32_t slot;  // bank slot for the next hit
+};
+
+struct ParamSnapshot
+{
+  std::atomic<uint32_t> seq{0}; // odd while writing, 0 = never published
+  std::atomic<uint32_t> step{0};
+  std::atomic<uint32_t> decay{0};
+  std::atomic<uint32_t> slot{0};
+};
+
+// Writer (one core only)
+void paramsPublish(ParamSnapshot &s, const Params &p);
+
+// Reader: true and `p` filled with a consistent set, or false (nothing
+// published yet, or torn by a concurrent write) with `p` untouched.
+bool paramsRead(const ParamSnapshot &s, Params &p);
+
+#endif // PARAMS_H
@@ -0,0 +1,91 @@
+#include "pool.h"
+
+#include "audio.h"
+
+void poolInit(VoicePool &p, uint32_t outputMilliHz)
+{
+  for (int i = 0; i < VOICE_COUNT; i++)
+  {
+    p.voices[i].playing = false;
+    p.rateScale[i] = 1u << 16;
+    p.started[i] = 0;
+  }
+  p.triggers = 0;
+  p.outputMilliHz = outputMilliHz;
+  p.step = VOICE_UNITY_STEP;
+  p.decay = VOICE_UNITY_GAIN;
+  p.hermite = false;
+}
+
+int poolTrigger(VoicePool &p, const SampleBank &bank, uint32_t slot)
+{
+  const SampleInfo &s = bank.samples[slot];
+
+  // First free voice, else the one started longest ago
+  int pick = 0;
+  for (int i = 0; i < VOICE_COUNT; i++)
+  {
+    if (!p.voices[i].playing)
+    {
+      pick = i;
+      break;
+    }
+    if (p.triggers - p.started[i] > p.triggers - p.started[pick])
+    {
+      pick = i;
+    }
+  }
+
+  p.rateScale[pick] =
+      (uint32_t)(((uint64_t)s.rootRate * 1000 << 16) / p.outputMilliHz);
+  p.started[pick] = ++p.triggers;
+  voiceStart(p.voices[pick], bank, slot, (uint32_t)s.gain << 16);
+  return pick;
+}
+
+void poolRender(VoicePool &p, int16_t *out, int count)
+{
+  static int32_t bus[AUDIO_BLOCK];
+
+  while (count > 0)
+  {
+    int n = (count < AUDIO_BLOCK) ? count : AUDIO_BLOCK;
+    for (int i = 0; i < n; i++)
+    {
+      bus[i] = 0;
+    }
+
+    // Pitch, decay and interpolation may change between blocks, not within
+    // one
+    for (int v = 0; v < VOICE_COUNT; v++)
+    {
+      Voice &voice = p.voices[v];
+      if (!voice.playing)
+      {
+        continue;
+      }
+      voice.step = (uint32_t)(((uint64_t)p.step * p.rateScale[v]) >> 16);
+      voice.decay = p.decay;
+      voice.hermite = p.hermite;
+      voiceMix(voice, bus, n);
+    }
+
+    for (int i = 0; i < n; i++)
+    {
+      int32_t s = bus[i];
+      out[i] = (int16_t)(s > 32767 ? 32767 : (s < -32768 ? -32768 : s));
+    }
+    out += n;
+    count -= n;
+  }
+}
+
+int poolActive(const VoicePool &p)
+{
+  int n = 0;
+  for (int i = 0; i < VOICE_COUNT; i++)
+  {
+    n += p.voices[i].playing ? 1 : 0;
+  }
+  return n;
+}
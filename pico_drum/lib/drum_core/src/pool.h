@@ -0,0 +1,42 @@
+#ifndef POOL_H
+#define POOL_H
+
+#include <stdint.h>
+
+#include "bank.h"
+#include "voice.h"
+
+// ── Voice pool ──────────────────────────────────────────────
+// A few voices mixed into one output, so a retrigger or a second sound
+// starts on a free voice and the previous hit rings out. When all voices
+// are busy the oldest one is stolen. Pitch and decay come from the pots
+// and apply to every voice; each voice also scales the pitch by its
+// sample's root rate.
+
+#define VOICE_COUNT 6
+
+struct VoicePool
+{
+  Voice voices[VOICE_COUNT];
+  uint32_t rateScale[VOICE_COUNT]; // Q16: root rate / output rate
+  uint32_t started[VOICE_COUNT];   // trigger number, oldest is stolen
+  uint32_t triggers;
+  uint32_t outputMilliHz;
+  uint32_t step;  // Q16.16 pitch, VOICE_UNITY_STEP plays at root rate
+  uint32_t decay; // Q31 per-sample envelope factor
+  bool hermite;   // 4-point Hermite interpolation on every voice
+};
+
+void poolInit(VoicePool &p, uint32_t outputMilliHz);
+
+// Start sample `slot` of `bank` on a free (or the oldest) voice. Returns
+// the voice number.
+int poolTrigger(VoicePool &p, const SampleBank &bank, uint32_t slot);
+
+// Mix all playing voices into `count` output samples (clipped to int16).
+void poolRender(VoicePool &p, int16_t *out, int count);
+
+// Voices currently playing
+int poolActive(const VoicePool &p);
+
+#endif // POOL_H
@@ -0,0 +1,294 @@
+#include "voice.h"
+
+// Catmull-Rom weights in Q14 for t = i / HERMITE_PHASES: outer for s[-1],
+// inner for s[0]. The kernel is symmetric, so s[1] and s[2] take the
+// inner and outer weights of 1 - t.
+#define HERMITE_PHASES 256
+
+struct HermiteTaps
+{
+  int16_t outer;
+  int16_t inner;
+};
+
+static const HermiteTaps hermiteTable[HERMITE_PHASES + 1] = {
+    {0, 16384}, {-32, 16383}, {-63, 16382}, {-94, 16378}, {-124, 16374},
+    {-154, 16369}, {-183, 16362}, {-212, 16354}, {-240, 16345}, {-268, 16334},
+    {-295, 16323}, {-322, 16310}, {-349, 16297}, {-375, 16282}, {-400, 16266},
+    {-425, 16248}, {-450, 16230}, {-474, 16211}, {-498, 16190}, {-521, 16168},
+    {-544, 16146}, {-566, 16122}, {-588, 16097}, {-610, 16071}, {-631, 16044},
+    {-651, 16016}, {-672, 15987}, {-691, 15957}, {-711, 15926}, {-730, 15894},
+    {-748, 15861}, {-766, 15827}, {-784, 15792}, {-801, 15756}, {-818, 15719},
+    {-835, 15681}, {-851, 15642}, {-866, 15603}, {-882, 15562}, {-897, 15520},
+    {-911, 15478}, {-925, 15434}, {-939, 15390}, {-953, 15345}, {-966, 15299},
+    {-978, 15252}, {-991, 15204}, {-1002, 15155}, {-1014, 15106}, {-1025, 15056},
+    {-1036, 15005}, {-1047, 14953}, {-1057, 14900}, {-1066, 14846}, {-1076, 14792},
+    {-1085, 14737}, {-1094, 14681}, {-1102, 14625}, {-1110, 14567}, {-1118, 14509},
+    {-1125, 14450}, {-1133, 14391}, {-1139, 14331}, {-1146, 14270}, {-1152, 14208},
+    {-1158, 14146}, {-1163, 14083}, {-1169, 14019}, {-1174, 13955}, {-1178, 13890},
+    {-1182, 13824}, {-1187, 13758}, {-1190, 13691}, {-1194, 13623}, {-1197, 13555},
+    {-1200, 13486}, {-1202, 13417}, {-1205, 13347}, {-1207, 13277}, {-1208, 13206},
+    {-1210, 13134}, {-1211, 13062}, {-1212, 12989}, {-1213, 12916}, {-1213, 12842},
+    {-1214, 12768}, {-1214, 12693}, {-1213, 12618}, {-1213, 12542}, {-1212, 12466},
+    {-1211, 12389}, {-1210, 12312}, {-1208, 12235}, {-1207, 12157}, {-1205, 12078},
+    {-1202, 11999}, {-1200, 11920}, {-1197, 11840}, {-1195, 11760}, {-1192, 11680},
+    {-1188, 11599}, {-1185, 11518}, {-1181, 11436}, {-1177, 11354}, {-1173, 11272},
+    {-1169, 11189}, {-1165, 11106}, {-1160, 11023}, {-1155, 10939}, {-1150, 10855},
+    {-1145, 10771}, {-1140, 10687}, {-1134, 10602}, {-1128, 10517}, {-1122, 10432},
+    {-1116, 10346}, {-1110, 10260}, {-1104, 10174}, {-1097, 10088}, {-1091, 10002},
+    {-1084, 9915}, {-1077, 9828}, {-1070, 9741}, {-1062, 9654}, {-1055, 9567},
+    {-1047, 9479}, {-1040, 9392}, {-1032, 9304}, {-1024, 9216}, {-1016, 9128},
+    {-1008, 9040}, {-999, 8951}, {-991, 8863}, {-982, 8775}, {-974, 8686},
+    {-965, 8597}, {-956, 8509}, {-947, 8420}, {-938, 8331}, {-929, 8242},
+    {-920, 8154}, {-911, 8065}, {-901, 7976}, {-892, 7887}, {-882, 7798},
+    {-872, 7709}, {-863, 7620}, {-853, 7531}, {-843, 7443}, {-833, 7354},
+    {-823, 7265}, {-813, 7177}, {-803, 7088}, {-793, 7000}, {-782, 6911},
+    {-772, 6823}, {-762, 6735}, {-751, 6647}, {-741, 6559}, {-730, 6472},
+    {-720, 6384}, {-709, 6297}, {-699, 6209}, {-688, 6122}, {-678, 6035},
+    {-667, 5949}, {-657, 5862}, {-646, 5776}, {-635, 5690}, {-625, 5604},
+    {-614, 5518}, {-603, 5433}, {-593, 5348}, {-582, 5263}, {-571, 5178},
+    {-561, 5094}, {-550, 5010}, {-539, 4926}, {-529, 4843}, {-518, 4760},
+    {-508, 4677}, {-497, 4595}, {-487, 4512}, {-476, 4431}, {-466, 4349},
+    {-455, 4268}, {-445, 4188}, {-435, 4107}, {-424, 4027}, {-414, 3948},
+    {-404, 3869}, {-394, 3790}, {-384, 3712}, {-374, 3634}, {-364, 3557},
+    {-354, 3480}, {-345, 3404}, {-335, 3328}, {-325, 3252}, {-316, 3177},
+    {-306, 3103}, {-297, 3029}, {-288, 2955}, {-278, 2882}, {-269, 2810},
+    {-260, 2738}, {-251, 2667}, {-243, 2596}, {-234, 2526}, {-225, 2456},
+    {-217, 2387}, {-209, 2319}, {-200, 2251}, {-192, 2184}, {-184, 2117},
+    {-176, 2052}, {-169, 1986}, {-161, 1922}, {-154, 1858}, {-146, 1794},
+    {-139, 1732}, {-132, 1670}, {-125, 1608}, {-119, 1548}, {-112, 1488},
+    {-106, 1429}, {-99, 1370}, {-93, 1313}, {-87, 1256}, {-82, 1200},
+    {-76, 1144}, {-70, 1090}, {-65, 1036}, {-60, 983}, {-55, 930},
+    {-51, 879}, {-46, 828}, {-42, 778}, {-38, 729}, {-34, 681},
+    {-30, 634}, {-26, 588}, {-23, 542}, {-20, 497}, {-17, 453},
+    {-14, 411}, {-12, 369}, {-10, 327}, {-8, 287}, {-6, 248},
+    {-4, 210}, {-3, 172}, {-2, 136}, {-1, 100}, {0, 66},
+    {0, 32}, {0, 0},
+};
+
+uint32_t voicePitchStep(int raw)
+{
+  // 0.5 + raw / 4095 * 1.5, in Q16.16, rounded to nearest
+  return VOICE_UNITY_STEP / 2 +
+         ((uint32_t)raw * (3 * VOICE_UNITY_STEP / 2) + 4095 / 2) / 4095;
+}
+
+uint32_t voiceDecay(int raw)
+{
+  // 0.998 + raw / 4095 * 0.002, in Q31 (control rate: 64-bit math is fine)
+  const uint64_t base = (uint64_t)VOICE_UNITY_GAIN * 998 / 1000;
+  const uint64_t span = (uint64_t)VOICE_UNITY_GAIN - base;
+  return (uint32_t)(base + span * (uint32_t)raw / 4095);
+}
+
+// Point decoder `slot` at the start of `level` (if the sample has it)
+static void startLevel(Voice &v, int slot, uint32_t level)
+{
+  if (level >= v.info->levels)
+  {
+    v.levelLen[slot] = 0;
+    return;
+  }
+  const SampleLevel &l = v.info->level[level];
+  adpcmStart(v.dec[slot], v.bank->data + l.offset,
+             v.bank->checkpoints + l.checkpoint);
+  v.levelLen[slot] = l.length;
+}
+
+void voiceStart(Voice &v, const SampleBank &bank, uint32_t slot,
+                uint32_t gain)
+{
+  v.bank = &bank;
+  v.info = &bank.samples[slot];
+  v.len = v.info->level[0].length;
+  v.level = 0;
+  v.blend = 0;
+  v.hermite = false;
+  startLevel(v, 0, 0);
+  startLevel(v, 1, 1);
+  v.pos = 0;
+  v.gain = gain;
+  v.playing = true;
+}
+
+// Octave of step → the pair of levels to read and the blend between them.
+// The blend is linear in the step's mantissa rather than in log2(step):
+// within 0.09 octave, and exact at the level boundaries.
+static void selectLevel(Voice &v)
+{
+  uint32_t levels = v.info->levels;
+  uint32_t level = 0;
+  uint32_t m = v.step;
+  while (m >= 2 * VOICE_UNITY_STEP && level + 1 < levels)
+  {
+    m >>= 1;
+    level++;
+  }
+  v.blend = (level + 1 < levels && m > VOICE_UNITY_STEP)
+                ? (int32_t)((m - VOICE_UNITY_STEP) >> 1)
+                : 0;
+  if (level == v.level)
+  {
+    return;
+  }
+
+  // One octave up or down keeps the decoder that is already on the level
+  if (level == v.level + 1)
+  {
+    v.dec[0] = v.dec[1];
+    v.levelLen[0] = v.levelLen[1];
+    startLevel(v, 1, level + 1);
+  }
+  else if (level + 1 == v.level)
+  {
+    v.dec[1] = v.dec[0];
+    v.levelLen[1] = v.levelLen[0];
+    startLevel(v, 0, level);
+  }
+  else
+  {
+    startLevel(v, 0, level);
+    startLevel(v, 1, level + 1);
+  }
+  v.level = level;
+}
+
+// Copy the ADPCM bytes the next `count` samples decode into the decoders'
+// RAM windows
+static void readAhead(Voice &v, int count)
+{
+  uint64_t last = v.pos + (uint64_t)v.step * (count - 1);
+  int slots = (v.blend != 0) ? 2 : 1;
+  for (int slot = 0; slot < slots; slot++)
+  {
+    uint64_t end = (last >> (16 + v.level + slot)) + 3; // as in fetch()
+    uint32_t len = v.levelLen[slot];
+    adpcmReadAhead(v.dec[slot], end < len ? (uint32_t)end : len, len);
+  }
+}
+
+// Levels and read-ahead for the next `count` samples
+static void prepare(Voice &v, int count)
+{
+  if (v.playing)
+  {
+    selectLevel(v);
+    readAhead(v, count);
+  }
+}
+
+// Interpolated sample of decoder `slot`, whose level is `shift` octaves
+// below level 0
+static inline int32_t fetch(Voice &v, int slot, uint32_t shift)
+{
+  AdpcmDecoder &d = v.dec[slot];
+  uint32_t p = v.pos >> shift; // Q16.16 at this level
+  uint32_t idx = p >> 16;
+
+  // Decode through idx + 2: hist is then s[idx - 1] … s[idx + 2]. Near the
+  // end, the samples past it are silence.
+  uint32_t len = v.levelLen[slot];
+  uint32_t end = idx + 3;
+  uint32_t past = 0;
+  if (end > len)
+  {
+    past = end - len;
+    end = len;
+  }
+  if (d.next != end) adpcmAdvance(d, end);
+
+  int32_t sm1, s0, s1, s2;
+  if (past == 0)
+  {
+    sm1 = d.hist[0];
+    s0 = d.hist[1];
+    s1 = d.hist[2];
+    s2 = d.hist[3];
+  }
+  else
+  {
+    int32_t s[4];
+    for (uint32_t i = 0; i < 4; i++)
+    {
+      s[i] = (i + past < 4) ? d.hist[i + past] : 0;
+    }
+    sm1 = s[0];
+    s0 = s[1];
+    s1 = s[2];
+    s2 = s[3];
+  }
+
+  if (v.hermite)
+  {
+    uint32_t phase = ((p & 0xFFFF) + 0x80) >> 8; // 0 … HERMITE_PHASES
+    const HermiteTaps &a = hermiteTable[phase];
+    const HermiteTaps &b = hermiteTable[HERMITE_PHASES - phase];
+    int32_t sample =
+        (sm1 * a.outer + s0 * a.inner + s1 * b.inner + s2 * b.outer + 0x2000) >>
+        14;
+    // The kernel overshoots a little on steep edges
+    return sample > 32767 ? 32767 : (sample < -32768 ? -32768 : sample);
+  }
+  int32_t frac = ((p & 0xFFFF) + 1) >> 1; // Q15, rounded
+  return s0 + (((s1 - s0) * frac + 0x4000) >> 15);
+}
+
+static inline int16_t next(Voice &v)
+{
+  if (!v.playing)
+  {
+    return 0;
+  }
+  if ((v.pos >> 16) >= v.len)
+  {
+    v.playing = false;
+    return 0;
+  }
+
+  int32_t sample = fetch(v, 0, v.level);
+  if (v.blend != 0)
+  {
+    int32_t upper = fetch(v, 1, v.level + 1);
+    sample += ((upper - sample) * v.blend + 0x4000) >> 15;
+  }
+
+  // gain <= 1.0, so the product stays within int16: no clamping needed.
+  // Q31 → Q16 keeps it a single 32-bit multiply.
+  int32_t gain = (int32_t)((v.gain + 0x4000) >> 15);
+  sample = (sample * gain + 0x8000) >> 16;
+
+  v.gain = (uint32_t)(((uint64_t)v.gain * v.decay) >> 31);
+  // End before the step rather than after it: with len up to 0xFFFF, a
+  // step above 1.0 could carry the Q16.16 position past 2^32 and wrap it
+  // back to the start
+  if (v.step >= (v.len << 16) - v.pos || v.gain < 0x4000)
+  {
+    v.playing = false; // past the end, or silent from here on
+  }
+  v.pos += v.step;
+  return (int16_t)sample;
+}
+
+int16_t voiceNext(Voice &v)
+{
+  prepare(v, 1);
+  return next(v);
+}
+
+void voiceRender(Voice &v, int16_t *out, int count)
+{
+  prepare(v, count);
+  for (int i = 0; i < count; i++)
+  {
+    out[i] = next(v);
+  }
+}
+
+void voiceMix(Voice &v, int32_t *bus, int count)
+{
+  prepare(v, count);
+  for (int i = 0; i < count && v.playing; i++)
+  {
+    bus[i] += next(v);
+  }
+}
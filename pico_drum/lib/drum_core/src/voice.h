@@ -0,0 +1,63 @@
+#ifndef VOICE_H
+#define VOICE_H
+
+#include <stdint.h>
+
+#include "adpcm.h"
+#include "bank.h"
+
+// ── Fixed-point sample voice ────────────────────────────────
+// The RP2040 has no FPU, so the per-sample path is integer-only:
+//   pos   Q16.16 read position in level-0 samples, advanced by step
+//   frac  Q15 linear interpolation weight between neighbouring samples
+//         (or a 4-point Hermite kernel, from a table)
+//   gain  Q31 exponential envelope, multiplied by decay every sample
+// The sample is ADPCM-decoded just ahead of pos as the voice plays.
+//
+// Above unity pitch the voice reads the sample's mipmap levels (bank.h):
+// between 2^k and 2^(k+1) it crossfades from level k to level k + 1, so
+// content that would fold back past the output Nyquist frequency fades
+// out as the pitch rises instead of aliasing.
+
+#define VOICE_UNITY_STEP 0x10000u    // Q16.16 1.0: original speed
+#define VOICE_UNITY_GAIN 0x80000000u // Q31 1.0
+
+struct Voice
+{
+  const SampleBank *bank;
+  const SampleInfo *info;
+  AdpcmDecoder dec[2]; // levels `level` and `level + 1`
+  uint32_t levelLen[2];
+  uint32_t level;
+  int32_t blend; // Q15 weight of level + 1
+  bool hermite;  // 4-point Hermite instead of linear interpolation
+  uint32_t len;  // level-0 samples
+  bool playing;
+  uint32_t pos;   // Q16.16 level-0 samples
+  uint32_t step;  // Q16.16 level-0 samples per output sample
+  uint32_t gain;  // Q31
+  uint32_t decay; // Q31 per-sample envelope factor
+};
+
+// Pot readings (12-bit) → voice parameters
+// pitch: 0.5× … 2.0× speed, decay: 0.998 … 1.0 per sample
+uint32_t voicePitchStep(int raw);
+uint32_t voiceDecay(int raw);
+
+// Play sample `slot` of `bank` from the start, at envelope level `gain`,
+// with linear interpolation.
+void voiceStart(Voice &v, const SampleBank &bank, uint32_t slot,
+                uint32_t gain = VOICE_UNITY_GAIN);
+
+// Next output sample, 0 when idle.
+int16_t voiceNext(Voice &v);
+
+// Fill a block with the next `count` samples (silence when idle). The
+// mipmap levels follow step, and the ADPCM read-ahead is refilled, once
+// per call.
+void voiceRender(Voice &v, int16_t *out, int count);
+
+// Add the next `count` samples to a mix bus.
+void voiceMix(Voice &v, int32_t *bus, int count);
+
+#endif // VOICE_H
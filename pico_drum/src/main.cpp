@@ -1,91 +1,249 @@
 #include <Arduino.h>
-#include "hardware/timer.h"
+#include "audio.h"
+#include "bank_image.h"
+#include "cv.h"
+#include "gate.h"
+#include "latency.h"
+#include "params.h"
+#include "pool.h"
 #include "sample_data.h"
 
 const int AUDIO_PIN = 6;
 const int GATE_PIN = 0;
 const int PITCH_PIN = A0;
 const int DECAY_PIN = A1;
+const int SAMPLE_PIN = A2; // kit slot for the next trigger
 const uint32_t SAMPLE_RATE_HZ = 44100;
-
-volatile bool playing = false;
-volatile float volume = 0.0f;
-volatile float decay = 0.99f;
-volatile float pos = 0.0f;
-volatile float pitch = 1.0f;
-
-struct repeating_timer sampleTimer;
-
-static int16_t u8_to_s16(uint8_t u)
+const uint32_t CONTROL_RATE_HZ = 1000; // pot/CV scan rate
+const int CV_OVERSAMPLE = 4;           // ADC reads averaged per scan
+
+// Print the audio render cost (CPU cycles per sample, avg/max over blocks)
+// and the exact output rate over USB serial
+#define AUDIO_STATS_SERIAL 0
+
+// Send 'h' over USB serial to print the trigger latency histogram (edge
+// timestamp to scheduled first sample: shows late hits, not GPIO latency)
+#define LATENCY_SERIAL 0
+
+// 4-point Hermite instead of linear interpolation: less imaging when
+// pitched down and no high-frequency droop, for 10-20% more render time
+#define HERMITE_INTERP 0
+
+// Core0 → core1: pitch, decay and sample slot
+ParamSnapshot params;
+
+// The kit: a bank image flashed on its own (wav_converter.py … -o bank.uf2)
+// if there is a valid one, else the one compiled in from sample_data.h.
+// Chosen once before either core starts.
+SampleBank flashBank;
+const BankImageStatus flashStatus = bankImageFlash(flashBank);
+const SampleBank &kit = (flashStatus == BANK_IMAGE_OK) ? flashBank : sampleBank;
+
+// ── Core1: audio ─────────────────────────────────────────────
+// Everything below runs in core1's DMA interrupt; core0 never masks it.
+VoicePool pool;
+uint32_t sampleSlot = 0; // bank slot for the next hit
+LatencyHistogram latency;
+
+// Requests from core0, served by the renderer between blocks
+volatile bool latencyClear = false;
+
+#if AUDIO_STATS_SERIAL
+// Written by core1 only; core0 reads the running totals and takes deltas
+volatile uint32_t renderCycles = 0;
+volatile uint32_t renderCyclesMax = 0;
+volatile uint32_t renderBlocks = 0;
+volatile bool statsClear = false;
+#endif
+
+// DMA interrupt, once per AUDIO_BLOCK samples
+void renderAudio(int16_t *out, int count)
 {
-  return (int16_t)((u - 128) * 256);
-}
+#if AUDIO_STATS_SERIAL
+  uint32_t start = rp2040.getCycleCount();
+#endif
 
-bool onTimer(struct repeating_timer*)
-{
-  if (!playing)
+  Params p;
+  if (paramsRead(params, p))
   {
-    analogWrite(AUDIO_PIN, 32767);
-    return true;
+    pool.step = p.step;
+    pool.decay = p.decay;
+    sampleSlot = p.slot;
   }
-
-  int idx = (int)pos;
-  if (idx >= SAMPLE_LEN)
+  if (latencyClear)
   {
-    playing = false;
-    analogWrite(AUDIO_PIN, 32767);
-    return true;
+    latencyReset(latency);
+    latencyClear = false;
   }
 
-  float frac = pos - idx;
-  int16_t s0 = u8_to_s16(sampleData[idx]);
-  int16_t s1 = (idx + 1 < SAMPLE_LEN) ? u8_to_s16(sampleData[idx + 1]) : 0;
-  float sample = s0 + frac * (s1 - s0);
-  sample *= volume;
+  // Start every queued hit whose scheduled sample falls in this block,
+  // rendering the voices up to that sample first
+  uint64_t first = audioRenderPosition();
+  int done = 0;
+  uint64_t edgeUs;
+  while (gatePeek(edgeUs))
+  {
+    uint64_t at = audioSampleAt(edgeUs) + GATE_LATENCY_SAMPLES;
+    if (at >= first + count)
+    {
+      break; // due in a later block
+    }
+    int offset = (at > first + done) ? (int)(at - first) : done; // late
+    poolRender(pool, out + done, offset - done);
+    done = offset;
+
+    poolTrigger(pool, kit, sampleSlot);
+    latencyRecord(latency, (uint32_t)(audioTimeOf(first + done) - edgeUs));
+    gatePop();
+  }
+  poolRender(pool, out + done, count - done);
 
-  if (sample > 32767.0f) sample = 32767.0f;
-  if (sample < -32768.0f) sample = -32768.0f;
+#if AUDIO_STATS_SERIAL
+  uint32_t cycles = rp2040.getCycleCount() - start;
+  if (statsClear)
+  {
+    renderCyclesMax = 0;
+    statsClear = false;
+  }
+  renderCycles += cycles;
+  if (cycles > renderCyclesMax) renderCyclesMax = cycles;
+  renderBlocks++;
+#endif
+}
 
-  uint16_t pwmValue = (uint16_t)((int32_t)sample + 32768);
-  analogWrite(AUDIO_PIN, pwmValue);
+void setup1()
+{
+  latencyReset(latency);
+
+  // audioBegin() renders the first blocks; the exact rate is known after.
+  // Its DMA interrupt is enabled on this core.
+  poolInit(pool, SAMPLE_RATE_HZ * 1000);
+  pool.hermite = HERMITE_INTERP;
+  audioBegin(AUDIO_PIN, SAMPLE_RATE_HZ, renderAudio);
+  pool.outputMilliHz = audioSampleRateMilliHz();
+}
 
-  volume *= decay;
-  pos += pitch;
-  return true;
+void loop1()
+{
+  // Nothing to poll: audio runs from the DMA interrupt
 }
 
+// ── Core0: CV, gate and serial ───────────────────────────────
+CvFilter pitchCv;
+CvFilter decayCv;
+CvFilter sampleCv;
+
 void setup()
 {
   pinMode(GATE_PIN, INPUT_PULLDOWN);
   analogReadResolution(12);
+#if AUDIO_STATS_SERIAL || LATENCY_SERIAL
+  Serial.begin(115200);
+#endif
+  cvInit(pitchCv);
+  cvInit(decayCv);
+  cvInit(sampleCv);
+
+  // Edges are time-stamped here and queued for the renderer on core1
+  gateBegin(GATE_PIN);
+}
 
-  analogWriteFreq(200000);
-  analogWriteRange(65535);
-  analogWrite(AUDIO_PIN, 32767);
-
-  int intervalUs = 1000000 / SAMPLE_RATE_HZ;
-  add_repeating_timer_us(-intervalUs, onTimer, NULL, &sampleTimer);
+// Average of a few back-to-back ADC reads
+int readCv(int pin)
+{
+  int sum = 0;
+  for (int i = 0; i < CV_OVERSAMPLE; i++)
+  {
+    sum += analogRead(pin);
+  }
+  return sum / CV_OVERSAMPLE;
 }
 
-void loop()
+#if AUDIO_STATS_SERIAL
+void printAudioStats()
 {
-  int rawPitch = analogRead(PITCH_PIN);
-  int rawDecay = analogRead(DECAY_PIN);
+  static uint32_t lastMs = 0;
+  static uint32_t lastCycles = 0;
+  static uint32_t lastBlocks = 0;
+  uint32_t now = millis();
+  if (now - lastMs < 1000)
+  {
+    return;
+  }
+  lastMs = now;
+
+  uint32_t cycles = renderCycles, blocks = renderBlocks;
+  uint32_t max = renderCyclesMax;
+  statsClear = true;
+  uint32_t sum = cycles - lastCycles, n = blocks - lastBlocks;
+  lastCycles = cycles;
+  lastBlocks = blocks;
+
+  // Per sample; the budget is one sample period in CPU cycles
+  uint32_t budget = F_CPU / SAMPLE_RATE_HZ;
+  uint32_t rate = audioSampleRateMilliHz();
+  // kit: "flash image", or why the built-in one is playing
+  Serial.printf("render cycles/sample avg %lu max %lu of %lu, %lu.%03lu Hz, "
+                "%d voices, kit: %s\n",
+                (unsigned long)(n ? sum / (n * AUDIO_BLOCK) : 0),
+                (unsigned long)(max / AUDIO_BLOCK), (unsigned long)budget,
+                (unsigned long)(rate / 1000), (unsigned long)(rate % 1000),
+                poolActive(pool),
+                flashStatus == BANK_IMAGE_OK ? "flash image"
+                                             : bankImageStatusName(flashStatus));
+}
+#endif
 
-  noInterrupts();
-  pitch = 0.5f + (rawPitch / 4095.0f) * 1.5f;
-  decay = 0.998f + (rawDecay / 4095.0f) * 0.002f;
-  interrupts();
+#if LATENCY_SERIAL
+// Non-empty bins of the latency histogram, then clear it
+void printLatency()
+{
+  if (Serial.available() == 0 || Serial.read() != 'h')
+  {
+    return;
+  }
+  Serial.printf("%lu hits, min %lu max %lu us, %lu dropped\n",
+                (unsigned long)latency.count, (unsigned long)latency.minUs,
+                (unsigned long)latency.maxUs, (unsigned long)gateDropped());
+  for (int i = 0; i < LATENCY_BINS; i++)
+  {
+    if (latency.bins[i] > 0)
+    {
+      Serial.printf("%4d-%4d us %lu\n", i * LATENCY_BIN_US,
+                    (i + 1) * LATENCY_BIN_US - 1,
+                    (unsigned long)latency.bins[i]);
+    }
+  }
+  if (latency.over > 0)
+  {
+    Serial.printf(">=%d us %lu\n", LATENCY_BINS * LATENCY_BIN_US,
+                  (unsigned long)latency.over);
+  }
+  latencyClear = true;
+}
+#endif
 
-  static bool lastGate = false;
-  bool gate = digitalRead(GATE_PIN);
-  if (gate && !lastGate)
+void loop()
+{
+  // Fixed control rate: oversampled, smoothed pots → one snapshot per tick
+  static uint32_t nextUs = micros();
+  if ((int32_t)(micros() - nextUs) < 0)
   {
-    noInterrupts();
-    playing = true;
-    pos = 0.0f;
-    volume = 1.0f;
-    interrupts();
+    return;
   }
-  lastGate = gate;
+  nextUs += 1000000 / CONTROL_RATE_HZ;
+
+  Params p;
+  p.step = voicePitchStep(cvFilter(pitchCv, readCv(PITCH_PIN)));
+  p.decay = voiceDecay(cvFilter(decayCv, readCv(DECAY_PIN)));
+  int sample = cvFilter(sampleCv, readCv(SAMPLE_PIN));
+  p.slot = (uint32_t)(sample * kit.count / 4096);
+  paramsPublish(params, p);
+
+#if AUDIO_STATS_SERIAL
+  printAudioStats();
+#endif
+#if LATENCY_SERIAL
+  printLatency();
+#endif
 }
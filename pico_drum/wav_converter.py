@@ -1,13 +1,39 @@
+import argparse
+import os
 import wave
 import struct
-import sys
+import zlib
 import numpy as np
 
 # === CONFIG ===
-INPUT_FILE = "909_oh.wav"    # path to your sample
 OUTPUT_FILE = "sample_data.h"
 TARGET_SAMPLE_RATE = 44100   # Hz, to match Arduino playback rate
-TARGET_BITS = 8              # output bit depth
+ADPCM_CHECKPOINT = 256       # samples between seek checkpoints (adpcm.h)
+MIP_LEVELS = 2               # level 0 + half rate: alias-free up to 2x pitch
+BANK_MAX_LEVELS = 4          # bank.h
+MAX_SAMPLE_LEN = 0xFFFF      # Q16.16 voice position
+
+# Bank image (bank_image.h), flashed on its own at the start of the core's
+# filesystem region: 1 MB before the last (EEPROM) sector of a 2 MB Pico
+BANK_IMAGE_MAGIC = 0x4B424450  # "PDBK"
+BANK_IMAGE_VERSION = 1
+BANK_IMAGE_SECTOR = 4096
+BANK_IMAGE_NAME = 16
+BANK_IMAGE_HEADER = 44
+BANK_FLASH_ADDRESS = 0x100FF000
+BANK_REGION_SIZE = 1024 * 1024
+UF2_FAMILY_RP2040 = 0xE48BFF56
+
+# IMA-ADPCM tables, as in lib/drum_core/src/adpcm.cpp
+STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41,
+    45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190,
+    209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724,
+    796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272,
+    2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132,
+    7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350,
+    22385, 24623, 27086, 29794, 32767]
+INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8]
 
 # === Helper functions ===
 def read_wav(filename):
@@ -25,41 +51,236 @@ def convert_to_mono(samples, n_channels):
         samples = samples.mean(axis=1)
     return samples
 
-# === Read and process WAV ===
-data, n_channels, width, rate, n_frames = read_wav(INPUT_FILE)
-
-# Decode based on bit depth
-if width == 2:
-    fmt = "<{}h".format(n_frames * n_channels)
-    samples = np.array(struct.unpack(fmt, data), dtype=np.float32)
-    samples /= 32768.0
-elif width == 1:
-    fmt = "<{}B".format(n_frames * n_channels)
-    samples = np.array(struct.unpack(fmt, data), dtype=np.float32)
-    samples = (samples - 128.0) / 128.0
-else:
-    raise ValueError("Unsupported bit depth")
-
-samples = convert_to_mono(samples, n_channels)
-
-# Resample if needed
-if rate != TARGET_SAMPLE_RATE:
-    import scipy.signal
-    samples = scipy.signal.resample_poly(samples, TARGET_SAMPLE_RATE, rate)
-
-# Normalize and quantize to 8-bit unsigned
-samples = np.clip(samples, -1.0, 1.0)
-samples_u8 = ((samples + 1.0) * 127.5).astype(np.uint8)
-
-# === Write C header ===
-with open(OUTPUT_FILE, "w") as f:
-    f.write("// Converted from {}\n".format(INPUT_FILE))
-    f.write("const uint8_t sampleData[] = {\n  ")
-    for i, s in enumerate(samples_u8):
-        f.write("{:d},".format(s))
-        if (i + 1) % 16 == 0:
-            f.write("\n  ")
-    f.write("\n};\n")
-    f.write("const int SAMPLE_LEN = {};\n".format(len(samples_u8)))
-
-print(f"✅ Conversion complete: {len(samples_u8)} samples written to {OUTPUT_FILE}")
\ No newline at end of file
+def load_sample(filename, target_rate):
+    data, n_channels, width, rate, n_frames = read_wav(filename)
+
+    # Decode based on bit depth
+    if width == 2:
+        fmt = "<{}h".format(n_frames * n_channels)
+        samples = np.array(struct.unpack(fmt, data), dtype=np.float32)
+        samples /= 32768.0
+    elif width == 1:
+        fmt = "<{}B".format(n_frames * n_channels)
+        samples = np.array(struct.unpack(fmt, data), dtype=np.float32)
+        samples = (samples - 128.0) / 128.0
+    else:
+        raise ValueError("Unsupported bit depth")
+
+    samples = convert_to_mono(samples, n_channels)
+
+    # Resample if needed
+    if rate != target_rate:
+        import scipy.signal
+        samples = scipy.signal.resample_poly(samples, target_rate, rate)
+    return np.clip(samples, -1.0, 1.0)
+
+def normalize(samples):
+    """Peak-normalise to the full 16-bit range; returns (float, Q15 gain)."""
+    peak = float(np.max(np.abs(samples))) if len(samples) else 0.0
+    if peak > 0.0:
+        samples = samples / peak
+    gain = min(32768, int(round(peak * 32768))) if peak > 0.0 else 0
+    return samples, gain
+
+def to_pcm(samples):
+    return np.round(np.clip(samples, -1.0, 1.0) * 32767.0).astype(np.int32)
+
+def mip_levels(samples, count):
+    """Level 0 is the sample; each next one is low-passed and decimated by 2
+    (resample_poly's linear-phase FIR keeps level k aligned with 2^k * n)."""
+    levels = [samples]
+    for _ in range(1, count):
+        import scipy.signal
+        levels.append(scipy.signal.resample_poly(levels[-1], 1, 2))
+    return levels
+
+def adpcm_decode_nibble(nibble, pred, index):
+    step = STEP_TABLE[index]
+    diff = step >> 3
+    if nibble & 4:
+        diff += step
+    if nibble & 2:
+        diff += step >> 1
+    if nibble & 1:
+        diff += step >> 2
+    pred = pred - diff if nibble & 8 else pred + diff
+    pred = max(-32768, min(32767, pred))
+    index = max(0, min(88, index + INDEX_TABLE[nibble & 7]))
+    return pred, index
+
+def adpcm_encode(pcm):
+    """IMA-ADPCM encode; returns (bytes, checkpoints, decoded samples).
+    Every sample gets the nibble that decodes nearest to it, as
+    host/bench.cpp's encodeLevel() chooses (the first on a tie), rather
+    than the reference encoder's truncating bit-by-bit quantiser."""
+    pred, index = 0, 0
+    nibbles, checkpoints, decoded = [], [], []
+    for i, s in enumerate(pcm):
+        if i % ADPCM_CHECKPOINT == 0:
+            checkpoints.append((pred, index))
+        s = int(s)
+        best, best_err, best_state = 0, None, None
+        for nibble in range(16):
+            state = adpcm_decode_nibble(nibble, pred, index)
+            err = abs(state[0] - s)
+            if best_err is None or err < best_err:
+                best, best_err, best_state = nibble, err, state
+        # Track the decoder exactly, so errors don't accumulate
+        pred, index = best_state
+        nibbles.append(best)
+        decoded.append(pred)
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    data = bytes(nibbles[i] | (nibbles[i + 1] << 4)
+                 for i in range(0, len(nibbles), 2))
+    return data, checkpoints, np.array(decoded, dtype=np.int32)
+
+def snr_db(source, decoded):
+    noise = np.sum((source.astype(np.float64) - decoded) ** 2)
+    signal = np.sum(source.astype(np.float64) ** 2)
+    if noise == 0:
+        return float("inf")
+    return 10.0 * np.log10(signal / noise)
+
+def build_bank(sounds, rate, levels=MIP_LEVELS):
+    """sounds: [(name, float samples)] → (data, checkpoints, entries)."""
+    data = bytearray()
+    checkpoints = []
+    bank = []  # ([(offset, length, checkpoint, snr)], root rate, gain, name)
+    for name, samples in sounds:
+        samples, gain = normalize(samples)
+        entry = []
+        for level in mip_levels(samples, levels):
+            pcm = to_pcm(level)
+            encoded, cps, decoded = adpcm_encode(pcm)
+            entry.append((len(data), len(pcm), len(checkpoints),
+                          snr_db(pcm, decoded)))
+            data += encoded
+            checkpoints += cps
+        bank.append((entry, rate, gain, name))
+    return data, checkpoints, bank
+
+def write_header(path, data, checkpoints, bank):
+    with open(path, "w") as f:
+        f.write("// Converted from {}\n".format(
+            ", ".join(entry[3] for entry in bank)))
+        f.write('#include "bank.h"\n')
+        f.write("// IMA-ADPCM, two samples per byte (low nibble first)\n")
+        f.write("const uint8_t sampleData[] = {\n  ")
+        for i, s in enumerate(data):
+            f.write("{:d},".format(s))
+            if (i + 1) % 16 == 0:
+                f.write("\n  ")
+        f.write("\n};\n")
+        f.write("const int SAMPLE_LEN = {};\n".format(len(data)))
+        f.write("const AdpcmState sampleCheckpoints[] = {\n")
+        for pred, index in checkpoints:
+            f.write("  {{{}, {}, 0}},\n".format(pred, index))
+        f.write("};\n")
+        f.write("const SampleInfo sampleInfo[] = {\n")
+        for levels, rate, gain, name in bank:
+            f.write("  {{{{{}}}, {}, {}, {}}}, // {}, {} dB SNR\n".format(
+                ", ".join("{{{}, {}, {}}}".format(*level[:3])
+                          for level in levels),
+                len(levels), rate, gain, name,
+                "/".join("{:.1f}".format(level[3]) for level in levels)))
+        f.write("};\n")
+        f.write("const int SAMPLE_COUNT = {};\n".format(len(bank)))
+        f.write("const SampleBank sampleBank = {sampleData, sampleCheckpoints, "
+                "sampleInfo, SAMPLE_COUNT};\n")
+
+def build_image(data, checkpoints, bank):
+    """Flat bank image: header, SampleInfo[], names, AdpcmState[], ADPCM."""
+    info = bytearray()
+    names = bytearray()
+    for levels, rate, gain, name in bank:
+        for k in range(BANK_MAX_LEVELS):
+            offset, length, cp = levels[k][:3] if k < len(levels) else (0, 0, 0)
+            info += struct.pack("<3I", offset, length, cp)
+        info += struct.pack("<IIH2x", len(levels), rate, gain)
+        names += name.encode()[:BANK_IMAGE_NAME - 1].ljust(BANK_IMAGE_NAME,
+                                                          b"\0")
+    states = b"".join(struct.pack("<hBB", pred, index, 0)
+                      for pred, index in checkpoints)
+
+    info_offset = BANK_IMAGE_HEADER
+    name_offset = info_offset + len(info)
+    checkpoint_offset = name_offset + len(names)
+    data_offset = checkpoint_offset + len(states)
+    body = bytes(info + names) + states + bytes(data)
+    size = BANK_IMAGE_HEADER + len(body)
+    header = struct.pack("<11I", BANK_IMAGE_MAGIC, BANK_IMAGE_VERSION, size,
+                         zlib.crc32(body), len(bank), info_offset, name_offset,
+                         checkpoint_offset, len(checkpoints), data_offset,
+                         len(data))
+    image = header + body
+    # Whole sectors, padded like erased flash
+    pad = -len(image) % BANK_IMAGE_SECTOR
+    return image + b"\xff" * pad
+
+def write_uf2(path, image, address):
+    """UF2 for the RP2040 boot drive: writes only the image's sectors."""
+    blocks = [image[i:i + 256] for i in range(0, len(image), 256)]
+    with open(path, "wb") as f:
+        for n, block in enumerate(blocks):
+            f.write(struct.pack("<8I", 0x0A324655, 0x9E5D5157, 0x00002000,
+                                address + n * 256, 256, n, len(blocks),
+                                UF2_FAMILY_RP2040))
+            f.write(block.ljust(476, b"\0"))
+            f.write(struct.pack("<I", 0x0AB16F30))
+
+# === Main ===
+def main():
+    parser = argparse.ArgumentParser(
+        description="Convert WAV files to a Pico Drum sample bank: a header "
+                    "to compile in (.h), or a bank image to flash on its own "
+                    "(.bin raw, .uf2 for the boot drive)")
+    parser.add_argument("inputs", nargs="+",
+                        help="WAV files, one bank slot each")
+    parser.add_argument("-o", "--output", default=OUTPUT_FILE,
+                        help="file to write, .h, .bin or .uf2 "
+                             "(default: %(default)s)")
+    parser.add_argument("--rate", type=int, default=TARGET_SAMPLE_RATE,
+                        help="sample rate to store (default: %(default)s Hz)")
+    parser.add_argument("--levels", type=int, default=MIP_LEVELS,
+                        choices=range(1, BANK_MAX_LEVELS + 1),
+                        help="mipmap levels per sample, each at half the "
+                             "rate of the last (default: %(default)s)")
+    parser.add_argument("--address", type=lambda v: int(v, 0),
+                        default=BANK_FLASH_ADDRESS,
+                        help="flash address of the image in a .uf2 "
+                             "(default: 0x%(default)X)")
+    args = parser.parse_args()
+
+    sounds = [(os.path.basename(n), load_sample(n, args.rate))
+              for n in args.inputs]
+    for name, samples in sounds:
+        if len(samples) > MAX_SAMPLE_LEN:
+            parser.error(f"{name}: {len(samples)} samples, the voice plays at "
+                         f"most {MAX_SAMPLE_LEN}")
+    data, checkpoints, bank = build_bank(sounds, args.rate, args.levels)
+
+    ext = os.path.splitext(args.output)[1].lower()
+    if ext in (".bin", ".uf2"):
+        image = build_image(data, checkpoints, bank)
+        if len(image) > BANK_REGION_SIZE:
+            parser.error(f"image is {len(image)} bytes, the flash region "
+                         f"holds {BANK_REGION_SIZE}")
+        print(f"Bank image: {len(image)} bytes "
+              f"({len(image) // BANK_IMAGE_SECTOR} sectors)")
+        if ext == ".uf2":
+            write_uf2(args.output, image, args.address)
+        else:
+            with open(args.output, "wb") as f:
+                f.write(image)
+    else:
+        write_header(args.output, data, checkpoints, bank)
+
+    for levels, rate, gain, name in bank:
+        snr = "/".join(f"{level[3]:.1f}" for level in levels)
+        print(f"{name}: {levels[0][1]} samples, {len(levels)} levels, "
+              f"ADPCM SNR {snr} dB")
+    print(f"✅ Conversion complete: {len(bank)} samples, {len(data)} bytes written to {args.output}")
+
+if __name__ == "__main__":
+    main()
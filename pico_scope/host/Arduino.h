@@ -0,0 +1,48 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// ── Host Arduino shim ───────────────────────────────────────
+// Just enough of the Arduino API for src/main.cpp to build on Linux. Pots
+// read from hostAnalog[] and buttons are held while hostPressed[] is set.
+// The USB serial port is closed (streaming stays quiet) unless Serial.out
+// points to a file, which then receives everything written; text output is
+// dropped.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+// Values returned by analogRead(), indexed by GPIO
+extern int hostAnalog[32];
+// Buttons (active low) held down, indexed by GPIO
+extern bool hostPressed[32];
+
+int analogRead(uint8_t pin);
+void analogReadResolution(int bits);
+int digitalRead(uint8_t pin);
+void pinMode(uint8_t pin, uint8_t mode);
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+
+struct HostSerial {
+  FILE *out = nullptr; // "host has the port open" while set
+
+  void begin(unsigned long) {}
+  explicit operator bool() const { return out != nullptr; }
+  int printf(const char *, ...) { return 0; }
+  size_t write(const uint8_t *buf, size_t n) {
+    return out ? fwrite(buf, 1, n, out) : n;
+  }
+};
+
+extern HostSerial Serial;
+
+#endif // HOST_ARDUINO_H
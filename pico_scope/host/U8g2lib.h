@@ -0,0 +1,51 @@
+#ifndef HOST_U8G2LIB_H
+#define HOST_U8G2LIB_H
+
+// ── Host U8g2 shim ──────────────────────────────────────────
+// Memory-backed SH1106 full buffer (8 pages x 128 bytes, LSB = top row) with
+// the drawing calls src/main.cpp uses (and the ones it used before the
+// column rasterizer, for host tests). Boxes, lines and pixels are drawn;
+// text is not (its width is still reported), so text pixels are missing
+// from dumped frames. Transfers only count the bytes they would send.
+
+#include <stdint.h>
+
+#define U8G2_R0 0
+#define U8X8_PIN_NONE 255
+
+// Fonts are just a glyph cell: {width, height}
+extern const uint8_t u8g2_font_4x6_tr[];
+extern const uint8_t u8g2_font_6x10_tr[];
+
+class U8G2_SH1106_128X64_NONAME_F_HW_I2C {
+public:
+  U8G2_SH1106_128X64_NONAME_F_HW_I2C(int rotation, int reset);
+
+  void begin();
+  void setFont(const uint8_t *font) { font_ = font; }
+  void setDrawColor(uint8_t color) { color_ = color; }
+  void clearBuffer();
+  uint8_t *getBufferPtr() { return buf_; }
+
+  void drawPixel(int x, int y);
+  void drawBox(int x, int y, int w, int h);
+  void drawHLine(int x, int y, int w);
+  void drawVLine(int x, int y, int h);
+  void drawLine(int x0, int y0, int x1, int y1);
+  void drawStr(int, int, const char *) {}
+  int getStrWidth(const char *s);
+
+  void sendBuffer();
+  void updateDisplayArea(int tx, int ty, int tw, int th);
+
+  // Bytes "sent" to the panel since start-up
+  uint32_t sentBytes() const { return sent_; }
+
+private:
+  uint8_t buf_[128 * 8];
+  const uint8_t *font_;
+  uint8_t color_;
+  uint32_t sent_;
+};
+
+#endif // HOST_U8G2LIB_H
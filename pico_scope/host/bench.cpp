@@ -0,0 +1,614 @@
+// ============================================================
+//  Pico Scope host benchmark
+//  Runs the firmware's core1 capture and core0 render paths back to back
+//  on Linux: the fake ADC is fed by synthetic signals (siggen.h), pots come
+//  from hostAnalog[] and the display is the memory-backed U8g2 shim.
+//
+//  Build with PROFILE_ENABLED=1 (see README), then:
+//    scope_bench [--frames N] [--dump DIR] [--check DIR] [--record FILE]...
+//  --dump writes the last frame of every scenario as DIR/<name>.pbm.
+//  --check compares those frames pixel for pixel with the references in
+//  DIR (host/golden) and exits non-zero on any difference; it always runs
+//  GOLDEN_FRAMES frames, the count the references were dumped with.
+//  Two more tables compare the trace mapping and drawing, and the trigger
+//  search, with the code they replaced (the trigger also on any --record
+//  stream captures).
+// ============================================================
+
+#include "../src/main.cpp"
+
+#include "siggen.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct Scenario {
+  const char *name;
+  DisplayMode mode;
+  uint32_t intervalUs; // time base, µs per sample
+  SigGen ch1;
+  SigGen ch2;
+};
+
+// 1 kHz-ish audio, LFO and clock material at the usual time bases
+static const Scenario scenarios[] = {
+    {"scope-sine", MODE_SCOPE, 20,
+     {SIG_SINE, 440000, 5000, 0, 0, 0},
+     {SIG_RAMP, 220000, 4000, 0, 0, 0}},
+    {"scope-noise", MODE_SCOPE, 20,
+     {SIG_NOISE, 0, 4000, 0, 0, 0},
+     {SIG_SQUARE, 2000000, 2000, 1000, 0, 0}},
+    {"scope-peak", MODE_SCOPE, 200,
+     {SIG_SQUARE, 100000, 5000, 0, 0, 0},
+     {SIG_SINE, 50000, 3000, 0, 0, 0}},
+    {"roll", MODE_SCOPE, 1000,
+     {SIG_SINE, 2000, 5000, 0, 0, 0},
+     {SIG_SQUARE, 1000, 5000, 0, 0, 0}},
+    {"average", MODE_AVERAGE, 20,
+     {SIG_SINE, 1000000, 3000, 0, 0, 0},
+     {SIG_NOISE, 0, 2000, 0, 0, 0}},
+    {"persist", MODE_PERSIST, 20,
+     {SIG_SINE, 1000000, 3000, 0, 0, 0},
+     {SIG_NOISE, 0, 2000, 0, 0, 0}},
+    {"ets", MODE_ETS, 20,
+     {SIG_SINE, 5000000, 5000, 0, 0, 0},
+     {SIG_SQUARE, 5000000, 5000, 0, 0, 0}},
+    {"segment", MODE_SEGMENT, 20,
+     {SIG_BURST, 200000, 5000, 0, 4, 8},
+     {SIG_RAMP, 25000, 5000, 0, 0, 0}},
+    {"xy", MODE_XY, 20,
+     {SIG_SINE, 300000, 5000, 0, 0, 0},
+     {SIG_SINE, 200000, 5000, 0, 0, 0}},
+    {"fft", MODE_FFT, 20,
+     {SIG_SQUARE, 1000000, 5000, 0, 0, 0},
+     {SIG_SINE, 1000000, 5000, 0, 0, 0}},
+};
+
+#define GOLDEN_FRAMES 50
+
+static SigGenInputs inputs;
+
+// Captures start at unrelated points of the signals, like on hardware
+// where the ADC is not synchronised to the input. Reproducible.
+static void nextCapture() {
+  static uint32_t lcg = 1;
+  lcg = lcg * 1664525u + 1013904223u;
+  inputs.originNs += 1000000 + (lcg >> 12);
+}
+
+// Pot reading that maps back to the wanted interval
+static int timePot(uint32_t intervalUs) {
+  uint32_t span = TDIV_MAX_US - TDIV_MIN_US;
+  return (int)(((intervalUs - TDIV_MIN_US) * 4095 + span - 1) / span);
+}
+
+// Display buffer (SH1106 pages) as a plain PBM image.
+static void dumpFrame(const char *dir, const char *name) {
+  char path[256];
+  snprintf(path, sizeof(path), "%s/%s.pbm", dir, name);
+  FILE *out = fopen(path, "w");
+  if (out == nullptr) {
+    fprintf(stderr, "cannot write %s\n", path);
+    return;
+  }
+  const uint8_t *buf = display.getBufferPtr();
+  fprintf(out, "P1\n%d %d\n", SCREEN_W, SCREEN_H);
+  for (int y = 0; y < SCREEN_H; y++) {
+    for (int x = 0; x < SCREEN_W; x++) {
+      int bit = (buf[(y >> 3) * SCREEN_W + x] >> (y & 7)) & 1;
+      fputc(bit ? '1' : '0', out);
+    }
+    fputc('\n', out);
+  }
+  fclose(out);
+}
+
+// Compare the display buffer with a reference PBM (as dumpFrame() writes
+// it). Returns false and says why on any difference.
+static bool checkFrame(const char *dir, const char *name) {
+  char path[256];
+  snprintf(path, sizeof(path), "%s/%s.pbm", dir, name);
+  FILE *in = fopen(path, "r");
+  if (in == nullptr) {
+    printf("golden %-11s missing %s\n", name, path);
+    return false;
+  }
+  int w = 0;
+  int h = 0;
+  bool ok = fscanf(in, "P1 %d %d", &w, &h) == 2 && w == SCREEN_W &&
+            h == SCREEN_H;
+  const uint8_t *buf = display.getBufferPtr();
+  int diff = 0;
+  for (int i = 0; ok && i < SCREEN_W * SCREEN_H; i++) {
+    int c;
+    do {
+      c = fgetc(in);
+    } while (c == ' ' || c == '\n' || c == '\r' || c == '\t');
+    if (c != '0' && c != '1') {
+      ok = false;
+      break;
+    }
+    int x = i % SCREEN_W;
+    int y = i / SCREEN_W;
+    int bit = (buf[(y >> 3) * SCREEN_W + x] >> (y & 7)) & 1;
+    diff += bit != c - '0';
+  }
+  fclose(in);
+  if (!ok) {
+    printf("golden %-11s unreadable %s\n", name, path);
+    return false;
+  }
+  if (diff > 0) {
+    printf("golden %-11s %d pixels differ from %s\n", name, diff, path);
+    return false;
+  }
+  return true;
+}
+
+static bool runScenario(const Scenario &s, int count, const char *dumpDir,
+                        const char *checkDir) {
+  inputs.ch[0] = s.ch1;
+  inputs.ch[1] = s.ch2;
+  hostAnalog[PIN_TIMEDIV] = timePot(s.intervalUs);
+  hostAnalog[PIN_VOLTDIV] = 1755; // vscale 1.0: 10 Vpp full screen
+  displayMode = s.mode;
+
+  // Settle: the first frames rebuild tables and fill the averages
+  for (int i = 0; i < 8; i++) {
+    segArmed = true;
+    nextCapture();
+    if (acquireFrame(*frames.back())) {
+      frames.publish();
+      loop();
+    }
+  }
+
+  profileReset();
+  uint32_t bytes0 = display.sentBytes();
+  uint32_t start = micros();
+  int drawn = 0;
+  for (int i = 0; i < count; i++) {
+    segArmed = true; // time a full burst capture, not just paging
+    nextCapture();
+    if (acquireFrame(*frames.back())) {
+      frames.publish();
+      loop();
+      drawn++;
+    }
+  }
+  uint32_t elapsed = micros() - start;
+  uint32_t bytes = display.sentBytes() - bytes0;
+
+  printf("%-11s %5lu %7.1f %6lu", s.name, (unsigned long)s.intervalUs,
+         elapsed ? drawn * 1e6 / elapsed : 0.0,
+         (unsigned long)(drawn ? bytes / drawn : 0));
+  for (int st = 0; st < PROF_STAGES; st++) {
+    ProfileStats ps;
+    profileStats((ProfileStage)st, ps);
+    printf(" %6lu", (unsigned long)ps.avgUs);
+  }
+  printf("\n");
+
+  if (dumpDir != nullptr) {
+    dumpFrame(dumpDir, s.name);
+  }
+  return checkDir == nullptr || checkFrame(checkDir, s.name);
+}
+
+// ── Trace render ────────────────────────────────────────────
+// Mapping and drawing both traces of a frame the way the firmware did
+// before ymap.h and raster.h (float adcToY() per sample, U8g2 drawLine()
+// and drawPixel()) and the way it does now (mapTrace() through the lookup
+// table, column rasterizer). The host has an FPU, so the float path costs
+// far less here than with the RP2040's soft-float library: read the ratio
+// as a lower bound. `ydiff` counts samples the two mappings put on
+// different rows.
+
+#define RENDER_FRAMES 200
+#define RENDER_REPEAT 20
+
+static int16_t legacyAdcToY(int16_t adcVal, float vdiv_scale,
+                            int16_t midADC) {
+  float normalized = (adcVal - midADC) / (float)(ADC_MAX / 2);
+  normalized /= vdiv_scale;
+  if (normalized < -1.0f) {
+    normalized = -1.0f;
+  } else if (normalized > 1.0f) {
+    normalized = 1.0f;
+  }
+  return (int16_t)(WAVEFORM_TOP + (WAVEFORM_H / 2) -
+                   normalized * (WAVEFORM_H / 2));
+}
+
+static void legacyDrawTraces(const int16_t *buf1, const int16_t *buf2,
+                             float vdivScale, int16_t mid1, int16_t mid2) {
+  for (int x = 0; x < SAMPLES - 1; x++) {
+    int y1a = legacyAdcToY(buf1[x], vdivScale, mid1);
+    int y1b = legacyAdcToY(buf1[x + 1], vdivScale, mid1);
+    int y2a = legacyAdcToY(buf2[x], vdivScale, mid2);
+    display.drawLine(x, y1a, x + 1, y1b);
+    if (x % 2 == 0) {
+      display.drawPixel(x, y2a);
+    }
+  }
+}
+
+static void tableDrawTraces(const int16_t *buf1, const int16_t *buf2,
+                            int16_t mid1, int16_t mid2) {
+  uint8_t *buf = display.getBufferPtr();
+  uint8_t ys[SAMPLES];
+  mapTrace(ys, buf1, mid1);
+  rasterSolid(buf, ys, SAMPLES);
+  mapTrace(ys, buf2, mid2);
+  rasterDotted(buf, ys, SAMPLES, 2);
+}
+
+static void benchRender() {
+  static int16_t ch1[RENDER_FRAMES][SAMPLES];
+  static int16_t ch2[RENDER_FRAMES][SAMPLES];
+  static int16_t mid1[RENDER_FRAMES];
+  static int16_t mid2[RENDER_FRAMES];
+  SigGen sig1 = {SIG_SINE, 1000000, 4000, 500, 0, 0};
+  SigGen sig2 = {SIG_RAMP, 300000, 3000, -1000, 0, 0};
+  uint64_t originNs = 0;
+  for (int f = 0; f < RENDER_FRAMES; f++) {
+    originNs += 1234567;
+    int32_t sum1 = 0;
+    int32_t sum2 = 0;
+    for (int i = 0; i < SAMPLES; i++) {
+      uint64_t ns = originNs + (uint64_t)i * 20000;
+      ch1[f][i] = ADC_MAX - (int16_t)siggenAdcCode(siggenMillivolts(sig1, ns));
+      ch2[f][i] = ADC_MAX - (int16_t)siggenAdcCode(siggenMillivolts(sig2, ns));
+      sum1 += ch1[f][i];
+      sum2 += ch2[f][i];
+    }
+    mid1[f] = (int16_t)(sum1 / SAMPLES);
+    mid2[f] = (int16_t)(sum2 / SAMPLES);
+  }
+
+  printf("\n%-13s %8s %8s %8s %6s\n", "render", "old us", "new us",
+         "table us", "ydiff");
+  static const float scales[] = {0.25f, 0.5f, 1.0f, 2.0f};
+  for (float scale : scales) {
+    uint32_t t0 = micros();
+    for (int rep = 0; rep < RENDER_REPEAT; rep++) {
+      for (int f = 0; f < RENDER_FRAMES; f++) {
+        display.clearBuffer();
+        legacyDrawTraces(ch1[f], ch2[f], scale, mid1[f], mid2[f]);
+      }
+    }
+    uint32_t t1 = micros();
+    for (int rep = 0; rep < RENDER_REPEAT; rep++) {
+      ymapInit(ymap); // time a rebuild, as when the V/div pot moves
+      ymapSetScale(ymap, scale);
+    }
+    uint32_t t2 = micros();
+    for (int rep = 0; rep < RENDER_REPEAT; rep++) {
+      for (int f = 0; f < RENDER_FRAMES; f++) {
+        display.clearBuffer();
+        ymapSetScale(ymap, scale); // unchanged: no rebuild
+        tableDrawTraces(ch1[f], ch2[f], mid1[f], mid2[f]);
+      }
+    }
+    uint32_t t3 = micros();
+
+    uint32_t ydiff = 0;
+    for (int f = 0; f < RENDER_FRAMES; f++) {
+      for (int i = 0; i < SAMPLES; i++) {
+        ydiff += legacyAdcToY(ch1[f][i], scale, mid1[f]) !=
+                 adcToY(ch1[f][i], mid1[f]);
+        ydiff += legacyAdcToY(ch2[f][i], scale, mid2[f]) !=
+                 adcToY(ch2[f][i], mid2[f]);
+      }
+    }
+
+    char name[16];
+    snprintf(name, sizeof(name), "vscale %.2f", scale);
+    double frames = (double)RENDER_FRAMES * RENDER_REPEAT;
+    printf("%-13s %8.2f %8.2f %8.2f %6lu\n", name, (t1 - t0) / frames,
+           (t3 - t2) / frames, (t2 - t1) / (double)RENDER_REPEAT,
+           (unsigned long)ydiff);
+  }
+}
+
+// ── Trigger search ──────────────────────────────────────────
+// triggerFind() with the firmware defaults (auto level, hysteresis,
+// interpolation) next to the findTrigger() it replaced: first rising
+// crossing of ADC_MID, no hysteresis, index 0 when nothing crosses.
+//
+// Synthetic captures start at random phases of a noisy periodic signal, so
+// the phase of the found crossing should not move; `jitter` is its RMS
+// spread in samples (a miss counts as position 0, which is what the
+// display showed). `wdiff` is the RMS code difference between consecutive
+// displayed windows, which needs no known signal and so also works on
+// recordings: --record FILE reads CH1 of every intact frame of a saved
+// stream (stream.h), e.g. `stream_reader.py /dev/ttyACM0 rec.bin` from a
+// Pico with STREAM_SERIAL on, or the .bin that scope_test --stream writes.
+
+#define TRIG_CAPTURES 500
+#define TRIG_REPEAT 20
+
+struct TriggerSignal {
+  const char *name;
+  uint32_t intervalUs;
+  SigGen sig;
+  int32_t noiseMv; // peak uniform noise added on top
+};
+
+static const TriggerSignal triggerSignals[] = {
+    {"sine+noise", 20, {SIG_SINE, 1000000, 3000, 0, 0, 0}, 300},
+    {"square+noise", 20, {SIG_SQUARE, 500000, 4000, 0, 0, 0}, 500},
+    {"ramp+noise", 20, {SIG_RAMP, 200000, 5000, 0, 0, 0}, 200},
+    {"offset-sine", 20, {SIG_SINE, 1000000, 1000, 2500, 0, 0}, 100},
+};
+
+static int legacyFindTrigger(const int16_t *buf, int bufLen) {
+  for (int i = 1; i < bufLen - SAMPLES; i++) {
+    if (buf[i - 1] < ADC_MID && buf[i] >= ADC_MID) {
+      return i;
+    }
+  }
+  return 0;
+}
+
+struct TriggerResult {
+  uint32_t found;
+  uint32_t searches;
+  uint64_t elapsedUs;
+  double wdiffSum; // squared window differences
+  uint32_t wdiffCount;
+  double phaseSum; // phase deviations (samples), and their squares
+  double phaseSq;
+  int16_t last[SAMPLES];
+};
+
+static void triggerReset(TriggerResult &r) {
+  memset(&r, 0, sizeof(r));
+}
+
+static void triggerAddWindow(TriggerResult &r, const int16_t *win) {
+  if (r.searches > 1) {
+    for (int i = 0; i < SAMPLES; i++) {
+      double d = win[i] - r.last[i];
+      r.wdiffSum += d * d;
+    }
+    r.wdiffCount += SAMPLES;
+  }
+  memcpy(r.last, win, sizeof(r.last));
+}
+
+static volatile int32_t triggerSink;
+
+// Search one capture with both kernels. Returns the displayed start of
+// each window in Q8 (old, new).
+static void triggerRun(const int16_t *buf, int len, TriggerResult &old,
+                       TriggerResult &now, int32_t &oldQ8, int32_t &newQ8) {
+  int pre = (SAMPLES * TRIG_DEFAULT_PRETRIG) >> 8;
+  TriggerConfig defaults = triggerDefaults();
+
+  uint32_t t0 = micros();
+  for (int rep = 0; rep < TRIG_REPEAT; rep++) {
+    triggerSink = legacyFindTrigger(buf, len);
+  }
+  uint32_t t1 = micros();
+  int32_t pos = -1;
+  for (int rep = 0; rep < TRIG_REPEAT; rep++) {
+    TriggerConfig cfg = triggerResolve(defaults, buf, len);
+    pos = triggerFind(buf, pre + 1, len - SAMPLES + pre + 1, cfg);
+    triggerSink = pos;
+  }
+  uint32_t t2 = micros();
+
+  int idx = legacyFindTrigger(buf, len);
+  old.elapsedUs += t1 - t0;
+  old.searches++;
+  old.found += idx > 0;
+  oldQ8 = (int32_t)idx << 8;
+
+  now.elapsedUs += t2 - t1;
+  now.searches++;
+  now.found += pos >= 0;
+  newQ8 = pos >= 0 ? pos - ((int32_t)pre << 8) : 0;
+
+  int16_t win[SAMPLES];
+  memcpy(win, buf + idx, sizeof(win));
+  triggerAddWindow(old, win);
+  triggerWindow(win, buf, newQ8, SAMPLES);
+  triggerAddWindow(now, win);
+}
+
+static void triggerPrint(const char *name, const char *kernel,
+                         const TriggerResult &r, bool phase) {
+  double n = r.searches ? r.searches : 1;
+  printf("%-13s %-6s %6.0f %5.1f", name, kernel,
+         r.elapsedUs * 1000.0 / (n * TRIG_REPEAT), 100.0 * r.found / n);
+  if (phase) {
+    double mean = r.phaseSum / n;
+    double var = r.phaseSq / n - mean * mean;
+    printf(" %7.2f", var > 0 ? sqrt(var) : 0.0);
+  } else {
+    printf(" %7s", "-");
+  }
+  printf(" %6.1f\n",
+         r.wdiffCount ? sqrt(r.wdiffSum / r.wdiffCount) : 0.0);
+}
+
+// Phase of a crossing relative to the first capture's, in samples, wrapped
+// to half a period either side.
+static double triggerPhase(uint64_t originNs, int32_t posQ8,
+                           uint32_t intervalUs, uint64_t periodNs,
+                           double &ref, bool first) {
+  uint64_t ns = originNs + (uint64_t)posQ8 * intervalUs * 1000 / 256;
+  double phase = (double)(ns % periodNs) / (intervalUs * 1000.0);
+  if (first) {
+    ref = phase;
+  }
+  double period = (double)periodNs / (intervalUs * 1000.0);
+  double d = phase - ref;
+  while (d >= period / 2) {
+    d -= period;
+  }
+  while (d < -period / 2) {
+    d += period;
+  }
+  return d;
+}
+
+static void benchTriggerSignal(const TriggerSignal &s) {
+  static int16_t buf[CAPTURE_LEN];
+  SigGen noise = {SIG_NOISE, 0, s.noiseMv, 0, 0, 0};
+  uint64_t periodNs = 1000000000000ull / s.sig.freqMilliHz;
+  uint64_t originNs = 0;
+  uint32_t lcg = 7;
+
+  TriggerResult old;
+  TriggerResult now;
+  triggerReset(old);
+  triggerReset(now);
+  double refOld = 0;
+  double refNew = 0;
+  for (int c = 0; c < TRIG_CAPTURES; c++) {
+    lcg = lcg * 1664525u + 1013904223u;
+    originNs += 1000000 + (lcg >> 12);
+    for (int i = 0; i < CAPTURE_LEN; i++) {
+      uint64_t ns = originNs + (uint64_t)i * s.intervalUs * 1000;
+      int32_t mv = siggenMillivolts(s.sig, ns) + siggenMillivolts(noise, ns);
+      buf[i] = ADC_MAX - (int16_t)siggenAdcCode(mv);
+    }
+
+    int32_t oldQ8;
+    int32_t newQ8;
+    triggerRun(buf, CAPTURE_LEN, old, now, oldQ8, newQ8);
+    double d = triggerPhase(originNs, oldQ8, s.intervalUs, periodNs, refOld,
+                            c == 0);
+    old.phaseSum += d;
+    old.phaseSq += d * d;
+    d = triggerPhase(originNs, newQ8, s.intervalUs, periodNs, refNew,
+                     c == 0);
+    now.phaseSum += d;
+    now.phaseSq += d * d;
+  }
+  triggerPrint(s.name, "old", old, true);
+  triggerPrint(s.name, "new", now, true);
+}
+
+// Every intact frame of a recorded stream, CH1 only.
+static bool benchTriggerRecording(const char *path) {
+  FILE *in = fopen(path, "rb");
+  if (in == nullptr) {
+    fprintf(stderr, "cannot read %s\n", path);
+    return false;
+  }
+  static uint8_t data[1 << 22];
+  size_t size = fread(data, 1, sizeof(data), in);
+  fclose(in);
+
+  const char *name = strrchr(path, '/');
+  name = name ? name + 1 : path;
+  static int16_t buf[4096];
+  TriggerResult old;
+  TriggerResult now;
+  triggerReset(old);
+  triggerReset(now);
+  for (size_t at = 0; at + sizeof(StreamHeader) + 2 <= size; at++) {
+    StreamHeader h;
+    memcpy(&h, data + at, sizeof(h));
+    if (memcmp(h.magic, STREAM_MAGIC, 4) != 0 ||
+        h.version != STREAM_VERSION || h.channels == 0 ||
+        h.count * h.channels > 4096 || h.count <= SAMPLES) {
+      continue;
+    }
+    size_t payload = (size_t)h.count * h.channels * 2;
+    if (at + sizeof(h) + payload + 2 > size) {
+      break;
+    }
+    StreamChecksum sum;
+    streamChecksumBegin(sum);
+    streamChecksumAdd(sum, data + at, sizeof(h) + payload);
+    uint16_t check;
+    memcpy(&check, data + at + sizeof(h) + payload, 2);
+    if (check != streamChecksumValue(sum)) {
+      continue;
+    }
+    for (int i = 0; i < h.count; i++) {
+      uint16_t raw;
+      memcpy(&raw, data + at + sizeof(h) + (size_t)i * h.channels * 2, 2);
+      buf[i] = ADC_MAX - (int16_t)(raw & ADC_MAX);
+    }
+    int32_t oldQ8;
+    int32_t newQ8;
+    triggerRun(buf, h.count, old, now, oldQ8, newQ8);
+    at += sizeof(h) + payload + 1;
+  }
+  if (now.searches == 0) {
+    fprintf(stderr, "%s: no stream frames\n", path);
+    return false;
+  }
+  triggerPrint(name, "old", old, false);
+  triggerPrint(name, "new", now, false);
+  return true;
+}
+
+int main(int argc, char **argv) {
+  int count = 200;
+  const char *dumpDir = nullptr;
+  const char *checkDir = nullptr;
+  const char *records[8];
+  int recordCount = 0;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+      count = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--dump") == 0 && i + 1 < argc) {
+      dumpDir = argv[++i];
+    } else if (strcmp(argv[i], "--check") == 0 && i + 1 < argc) {
+      checkDir = argv[++i];
+    } else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc &&
+               recordCount < 8) {
+      records[recordCount++] = argv[++i];
+    } else {
+      fprintf(stderr,
+              "usage: %s [--frames N] [--dump DIR] [--check DIR] "
+              "[--record FILE]...\n",
+              argv[0]);
+      return 1;
+    }
+  }
+  if (checkDir != nullptr) {
+    count = GOLDEN_FRAMES;
+  }
+
+  fakeAdcSetSignal(siggenFakeAdc, &inputs);
+  setup1();
+  setup();
+
+  // Host wall-clock µs; capture includes the fake ADC's signal synthesis
+  printf("%-11s %5s %7s %6s", "scenario", "us/px", "fps", "B/frm");
+  for (int st = 0; st < PROF_STAGES; st++) {
+    printf(" %6s", profileName((ProfileStage)st));
+  }
+  printf("\n");
+  int mismatches = 0;
+  for (const Scenario &s : scenarios) {
+    mismatches += !runScenario(s, count, dumpDir, checkDir);
+  }
+
+  benchRender();
+
+  // ns per search includes the auto level scan; jitter in samples
+  printf("\n%-13s %-6s %6s %5s %7s %6s\n", "signal", "kernel", "ns", "hit%",
+         "jitter", "wdiff");
+  for (const TriggerSignal &s : triggerSignals) {
+    benchTriggerSignal(s);
+  }
+  bool ok = mismatches == 0;
+  for (int i = 0; i < recordCount; i++) {
+    ok = benchTriggerRecording(records[i]) && ok;
+  }
+  if (checkDir != nullptr) {
+    printf("\ngolden   %s  %d of %d frames differ from %s\n",
+           mismatches ? "FAIL" : "ok  ", mismatches,
+           (int)(sizeof(scenarios) / sizeof(scenarios[0])), checkDir);
+  }
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,139 @@
+#include "Arduino.h"
+#include "U8g2lib.h"
+
+#include <chrono>
+#include <string.h>
+
+// ── Arduino ─────────────────────────────────────────────────
+int hostAnalog[32];
+bool hostPressed[32];
+HostSerial Serial;
+
+int analogRead(uint8_t pin) { return hostAnalog[pin & 31]; }
+void analogReadResolution(int) {}
+int digitalRead(uint8_t pin) { return hostPressed[pin & 31] ? LOW : HIGH; }
+void pinMode(uint8_t, uint8_t) {}
+
+static uint64_t hostMicros() {
+  using namespace std::chrono;
+  return (uint64_t)duration_cast<microseconds>(
+             steady_clock::now().time_since_epoch())
+      .count();
+}
+
+uint32_t millis() { return (uint32_t)(hostMicros() / 1000); }
+uint32_t micros() { return (uint32_t)hostMicros(); }
+void delay(uint32_t) {} // nobody needs to read the splash screen
+
+long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// ── U8g2 ────────────────────────────────────────────────────
+const uint8_t u8g2_font_4x6_tr[] = {4, 6};
+const uint8_t u8g2_font_6x10_tr[] = {6, 10};
+
+U8G2_SH1106_128X64_NONAME_F_HW_I2C::U8G2_SH1106_128X64_NONAME_F_HW_I2C(int,
+                                                                     int)
+    : font_(u8g2_font_4x6_tr), color_(1), sent_(0) {
+  clearBuffer();
+}
+
+void U8G2_SH1106_128X64_NONAME_F_HW_I2C::begin() { clearBuffer(); }
+
+void U8G2_SH1106_128X64_NONAME_F_HW_I2C::clearBuffer() {
+  memset(buf_, 0, sizeof(buf_));
+}
+
+void U8G2_SH1106_128X64_NONAME_F_HW_I2C::drawPixel(int x, int y) {
+  if (x < 0 || x >= 128 || y < 0 || y >= 64) {
+    return;
+  }
+  uint8_t bit = 1 << (y & 7);
+  uint8_t &b = buf_[(y >> 3) * 128 + x];
+  if (color_ == 0) {
+    b &= ~bit;
+  } else if (color_ == 2) {
+    b ^= bit;
+  } else {
+    b |= bit;
+  }
+}
+
+void U8G2_SH1106_128X64_NONAME_F_HW_I2C::drawBox(int x, int y, int w, int h) {
+  for (int yy = y; yy < y + h; yy++) {
+    for (int xx = x; xx < x + w; xx++) {
+      drawPixel(xx, yy);
+    }
+  }
+}
+
+void U8G2_SH1106_128X64_NONAME_F_HW_I2C::drawHLine(int x, int y, int w) {
+  drawBox(x, y, w, 1);
+}
+
+void U8G2_SH1106_128X64_NONAME_F_HW_I2C::drawVLine(int x, int y, int h) {
+  drawBox(x, y, 1, h);
+}
+
+static void swap16(uint16_t &a, uint16_t &b) {
+  uint16_t t = a;
+  a = b;
+  b = t;
+}
+
+// u8g2_DrawLine() step for step, with the 16-bit coordinates U8g2 uses on
+// the RP2040: the reference the column rasterizer (raster.h) is checked
+// against, so keep it exact rather than tidy.
+void U8G2_SH1106_128X64_NONAME_F_HW_I2C::drawLine(int x0, int y0, int x1,
+                                                  int y1) {
+  uint16_t ax = (uint16_t)x0;
+  uint16_t ay = (uint16_t)y0;
+  uint16_t bx = (uint16_t)x1;
+  uint16_t by = (uint16_t)y1;
+  uint16_t dx = (ax > bx) ? ax - bx : bx - ax;
+  uint16_t dy = (ay > by) ? ay - by : by - ay;
+
+  bool swapxy = false;
+  if (dy > dx) {
+    swapxy = true;
+    swap16(dx, dy);
+    swap16(ax, ay);
+    swap16(bx, by);
+  }
+  if (ax > bx) {
+    swap16(ax, bx);
+    swap16(ay, by);
+  }
+  int16_t err = (int16_t)(dx >> 1);
+  int16_t ystep = (by > ay) ? 1 : -1;
+  uint16_t y = ay;
+  if (bx == 0xffff) {
+    bx--;
+  }
+  for (uint16_t x = ax; x <= bx; x++) {
+    if (!swapxy) {
+      drawPixel(x, y);
+    } else {
+      drawPixel(y, x);
+    }
+    err -= (int16_t)dy;
+    if (err < 0) {
+      y += ystep;
+      err += (int16_t)dx;
+    }
+  }
+}
+
+int U8G2_SH1106_128X64_NONAME_F_HW_I2C::getStrWidth(const char *s) {
+  return (int)strlen(s) * font_[0];
+}
+
+void U8G2_SH1106_128X64_NONAME_F_HW_I2C::sendBuffer() {
+  sent_ += sizeof(buf_);
+}
+
+void U8G2_SH1106_128X64_NONAME_F_HW_I2C::updateDisplayArea(int, int, int tw,
+                                                           int th) {
+  sent_ += (uint32_t)(tw * th * 8);
+}
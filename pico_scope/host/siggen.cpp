@@ -0,0 +1,73 @@
+#include "siggen.h"
+#include "config.h"
+
+#include <math.h>
+
+// Reproducible noise: hash of the sample time
+static uint32_t hash(uint64_t x) {
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdull;
+  x ^= x >> 33;
+  return (uint32_t)x;
+}
+
+int32_t siggenMillivolts(const SigGen &g, uint64_t ns) {
+  if (g.shape == SIG_NOISE) {
+    int32_t r = (int32_t)(hash(ns) >> 16) - 32768; // -32768..32767
+    return g.offsetMv + (int32_t)((int64_t)r * g.amplitudeMv / 32768);
+  }
+  if (g.freqMilliHz == 0) {
+    return g.offsetMv;
+  }
+
+  // Phase in cycles: whole cycles and fraction (Q16)
+  uint64_t periodNs = 1000000000000ull / g.freqMilliHz;
+  uint64_t cycle = ns / periodNs;
+  uint32_t phase = (uint32_t)((ns % periodNs) * 65536 / periodNs);
+
+  int32_t v;
+  switch (g.shape) {
+  case SIG_SINE:
+    v = (int32_t)lroundf(g.amplitudeMv *
+                         sinf(2.0f * 3.14159265f * phase / 65536.0f));
+    break;
+  case SIG_RAMP:
+    v = (int32_t)((int64_t)g.amplitudeMv * ((int32_t)phase - 32768) / 32768);
+    break;
+  case SIG_BURST:
+    if (g.burstEvery > 0 && cycle % g.burstEvery >= g.burstOn) {
+      return g.offsetMv - g.amplitudeMv; // idle low between bursts
+    }
+    // fall through
+  default: // SIG_SQUARE
+    v = (phase < 32768) ? g.amplitudeMv : -g.amplitudeMv;
+    break;
+  }
+  return g.offsetMv + v;
+}
+
+uint16_t siggenAdcCode(int32_t mv) {
+  int32_t code = ADC_MID - mv * 1000 / ADC_UV_PER_CODE;
+  if (code < 0) {
+    code = 0;
+  }
+  if (code > ADC_MAX) {
+    code = ADC_MAX;
+  }
+  return (uint16_t)code;
+}
+
+uint16_t siggenFakeAdc(uint8_t input, uint32_t n, uint32_t periodNs,
+                       void *ctx) {
+  const SigGenInputs *in = (const SigGenInputs *)ctx;
+  int ch;
+  if (input == PIN_CH1 - ADC_FIRST_PIN) {
+    ch = 0;
+  } else if (input == PIN_CH2 - ADC_FIRST_PIN) {
+    ch = 1;
+  } else {
+    return siggenAdcCode(0);
+  }
+  uint64_t ns = in->originNs + (uint64_t)n * periodNs;
+  return siggenAdcCode(siggenMillivolts(in->ch[ch], ns));
+}
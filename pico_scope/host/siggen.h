@@ -0,0 +1,47 @@
+#ifndef SIGGEN_H
+#define SIGGEN_H
+
+#include <stdint.h>
+
+// ── Synthetic signal sources (host only) ────────────────────
+// Test signals in Eurorack volts: they feed the fake ADC
+// (capture_fake.cpp) with the raw codes the inverting input stage would
+// produce, so capture, trigger and drawing run on realistic input.
+
+enum SigShape : uint8_t {
+  SIG_SINE,
+  SIG_SQUARE,
+  SIG_RAMP,  // rising saw
+  SIG_NOISE, // uniform white noise, reproducible
+  SIG_BURST  // square, on for burstOn cycles out of every burstEvery
+};
+
+struct SigGen {
+  SigShape shape;
+  uint32_t freqMilliHz;
+  int32_t amplitudeMv; // peak, i.e. half of peak-to-peak
+  int32_t offsetMv;
+  uint8_t burstOn;     // SIG_BURST only
+  uint8_t burstEvery;
+};
+
+// Input voltage at time `ns`, in millivolts.
+int32_t siggenMillivolts(const SigGen &g, uint64_t ns);
+
+// Raw ADC code for an input voltage (inverting input stage, clamped).
+uint16_t siggenAdcCode(int32_t mv);
+
+// Signals on the two scope inputs. The fake ADC counts samples from each
+// capture start, so advance originNs between captures or every capture
+// starts at the same phase of the signal.
+struct SigGenInputs {
+  SigGen ch[2]; // CH1, CH2
+  uint64_t originNs;
+};
+
+// Fake ADC source: `ctx` points to a SigGenInputs. Any other ADC input
+// reads 0 V.
+uint16_t siggenFakeAdc(uint8_t input, uint32_t n, uint32_t periodNs,
+                       void *ctx);
+
+#endif // SIGGEN_H
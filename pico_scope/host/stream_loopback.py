@@ -0,0 +1,153 @@
+"""Loopback test of the USB waveform stream.
+
+    python host/stream_loopback.py ./scope_test
+
+Runs the host test program with its serial port open on a file, so the
+firmware's streamCapture() writes real frames, and decodes them with
+stream_reader.py. Every sample, trigger index and sequence number is
+checked against what the fake ADC produced, through the CSV, WAV and
+raw writers too. A damaged copy of the stream checks that the reader
+skips junk and drops a corrupted frame without losing the ones after it.
+Exits non-zero on any mismatch.
+"""
+import contextlib
+import csv
+import io
+import os
+import subprocess
+import sys
+import tempfile
+import wave
+
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), ".."))
+import stream_reader  # noqa: E402
+
+INTERVAL_NS = 20000  # scope_test streams at the fastest time base
+
+
+def load_reference(path):
+    """seq → (trigger index or None, ch1 codes, ch2 codes)."""
+    frames = {}
+    with open(path) as f:
+        for row in csv.DictReader(f):
+            seq = int(row["seq"])
+            trig, ch1, ch2 = frames.setdefault(seq, [None, [], []])
+            if row["trigger"] == "1":
+                frames[seq][0] = int(row["index"])
+            ch1.append(int(row["ch1"]))
+            ch2.append(int(row["ch2"]))
+    return frames
+
+
+def check_frames(decoded, reference, skip=()):
+    errors = []
+    expected = [seq for seq in sorted(reference) if seq not in skip]
+    got = [header["seq"] for header, _ in decoded]
+    if got != expected:
+        errors.append(f"frames {got}, expected {expected}")
+        return errors
+    for header, samples in decoded:
+        trig, ch1, ch2 = reference[header["seq"]]
+        if header["interval_ns"] != INTERVAL_NS:
+            errors.append(f"frame {header['seq']}: interval "
+                          f"{header['interval_ns']} ns")
+        if header["trigger"] != trig:
+            errors.append(f"frame {header['seq']}: trigger "
+                          f"{header['trigger']}, expected {trig}")
+        if list(samples[0]) != ch1 or list(samples[1]) != ch2:
+            errors.append(f"frame {header['seq']}: samples differ")
+    return errors
+
+
+def check_csv(path, reference):
+    errors = []
+    with open(path) as f:
+        rows = list(csv.DictReader(f))
+    if len(rows) != sum(len(r[1]) for r in reference.values()):
+        return [f"CSV has {len(rows)} rows"]
+    for row in rows:
+        trig, ch1, ch2 = reference[int(row["seq"])]
+        i = int(row["index"])
+        want = (f"{stream_reader.to_volts(ch1[i]):.4f}",
+                f"{stream_reader.to_volts(ch2[i]):.4f}")
+        if (row["ch1_v"], row["ch2_v"]) != want:
+            errors.append(f"CSV frame {row['seq']} sample {i}: "
+                          f"{row['ch1_v']}, {row['ch2_v']} V, expected {want}")
+            break
+        if (row["trigger"] == "1") != (trig == i):
+            errors.append(f"CSV frame {row['seq']} sample {i}: trigger flag")
+            break
+    return errors
+
+
+def check_wav(path, reference):
+    with wave.open(path, "rb") as wf:
+        count = wf.getnframes()
+        rate = wf.getframerate()
+        data = wf.readframes(count)
+    want = sum(len(r[1]) for r in reference.values())
+    if count != want or rate != 1000000000 // INTERVAL_NS:
+        return [f"WAV has {count} frames at {rate} Hz"]
+    first = reference[min(reference)]
+    code = first[1][0]
+    sample = int.from_bytes(data[:2], "little", signed=True)
+    if sample != (stream_reader.ADC_MID - code) * 16:
+        return [f"WAV first sample {sample} for code {code}"]
+    return []
+
+
+def main():
+    if len(sys.argv) != 2:
+        print(__doc__.strip().splitlines()[2].strip(), file=sys.stderr)
+        return 2
+    with tempfile.TemporaryDirectory() as tmp:
+        prefix = os.path.join(tmp, "loop")
+        subprocess.run([sys.argv[1], "--stream", prefix], check=True)
+        reference = load_reference(prefix + ".csv")
+        with open(prefix + ".bin", "rb") as f:
+            data = f.read()
+
+        errors = []
+        decoded = list(stream_reader.read_frames(io.BytesIO(data)))
+        errors += check_frames(decoded, reference)
+
+        csv_path = os.path.join(tmp, "out.csv")
+        stream_reader.write_csv(
+            stream_reader.read_frames(io.BytesIO(data)), csv_path)
+        errors += check_csv(csv_path, reference)
+
+        wav_path = os.path.join(tmp, "out.wav")
+        stream_reader.write_wav(
+            stream_reader.read_frames(io.BytesIO(data)), wav_path)
+        errors += check_wav(wav_path, reference)
+
+        raw_path = os.path.join(tmp, "out.bin")
+        stream_reader.write_raw(
+            stream_reader.read_frames(io.BytesIO(data)), raw_path)
+        with open(raw_path, "rb") as f:
+            raw = f.read()
+        if raw != data:
+            errors.append(f"raw dump: {len(raw)} bytes differ from the "
+                          f"{len(data)} streamed")
+
+        # Joined mid-frame after some text, with one bit flipped in frame 3
+        size = len(data) // len(reference)
+        damaged = bytearray(b"fps 20, 1024 bytes/frame\r\n")
+        damaged += data[size // 2:size]  # tail of frame 0
+        damaged += data[size:]
+        damaged[len(damaged) - (len(reference) - 3) * size + 100] ^= 0x10
+        with contextlib.redirect_stderr(io.StringIO()):
+            decoded = list(stream_reader.read_frames(io.BytesIO(damaged)))
+        errors += [f"damaged stream: {e}"
+                   for e in check_frames(decoded, reference, skip=(0, 3))]
+
+    for e in errors:
+        print(e)
+    frames = len(reference)
+    print(f"stream   {'FAIL' if errors else 'ok  '}  {frames} frames through "
+          f"stream_reader.py (frames, CSV, WAV, raw, resync and checksum)")
+    return 1 if errors else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,632 @@
+// ============================================================
+//  Pico Scope host tests
+//  Checks the firmware's integer kernels against plain references on
+//  Linux, with the same shims as the benchmark. Prints one line per test
+//  and exits non-zero if any of them fails.
+//
+//    scope_test
+// ============================================================
+
+#include "../src/main.cpp"
+
+#include "siggen.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+static int failures = 0;
+
+static void report(const char *name, bool ok, const char *detail) {
+  printf("%-8s %s  %s\n", name, ok ? "ok  " : "FAIL", detail);
+  if (!ok) {
+    failures++;
+  }
+}
+
+// Reproducible random numbers in [0, n)
+static uint32_t lcg = 1;
+static uint32_t rnd(uint32_t n) {
+  lcg = lcg * 1664525u + 1013904223u;
+  return (lcg >> 8) % n;
+}
+
+static uint32_t hostNs() {
+  return micros() * 1000;
+}
+
+// ── Column rasterizer (raster.h) ────────────────────────────
+// The raster output has to match, bit for bit, what the renderer drew
+// through U8g2 before raster.h: drawLine() segments for CH1, every other
+// pixel for CH2, the dotted centre line, drawVLine() peak-detect spans and
+// the drawHLine() level tick. The shim's drawLine() is U8g2's algorithm.
+
+static const int RASTER_TRACES = 4000;
+
+// Random trace in one of the shapes the scope sees: noise (steep
+// segments), a random walk, a saw and a flat line. Y runs past the screen
+// to cover clipping.
+static void randomTrace(uint8_t *ys) {
+  uint32_t kind = rnd(4);
+  int y = rnd(SCREEN_H);
+  for (int x = 0; x < SAMPLES; x++) {
+    if (kind == 0) {
+      y = rnd(SCREEN_H + 16);
+    } else if (kind == 1) {
+      y += (int)rnd(7) - 3;
+      y = (y < 0) ? 0 : (y > SCREEN_H + 15) ? SCREEN_H + 15 : y;
+    } else if (kind == 2) {
+      y = (y + 5) % SCREEN_H;
+    }
+    ys[x] = (uint8_t)y;
+  }
+}
+
+static void drawTracesU8g2(const uint8_t *ys1, const uint8_t *ys2) {
+  int midY = WAVEFORM_TOP + WAVEFORM_H / 2;
+  for (int x = 0; x < SCREEN_W; x += 4) {
+    display.drawPixel(x, midY);
+  }
+  for (int x = 0; x < SAMPLES - 1; x++) {
+    display.drawLine(x, ys1[x], x + 1, ys1[x + 1]);
+    if (x % 2 == 0) {
+      display.drawPixel(x, ys2[x]);
+    }
+  }
+}
+
+static void drawTracesRaster(const uint8_t *ys1, const uint8_t *ys2) {
+  uint8_t *buf = display.getBufferPtr();
+  rasterHDots(buf, WAVEFORM_TOP + WAVEFORM_H / 2, 4);
+  rasterSolid(buf, ys1, SAMPLES);
+  rasterDotted(buf, ys2, SAMPLES, 2);
+}
+
+// Peak-detect spans (y0 <= y1 on screen, as drawSpans() passes them) and
+// the three-pixel level tick.
+static void drawSpansU8g2(const uint8_t *y0, const uint8_t *y1) {
+  for (int x = 0; x < SAMPLES; x++) {
+    display.drawVLine(x, y0[x], y1[x] - y0[x] + 1);
+  }
+  display.drawHLine(0, y0[0], 3);
+}
+
+static void drawSpansRaster(const uint8_t *y0, const uint8_t *y1) {
+  uint8_t *buf = display.getBufferPtr();
+  for (int x = 0; x < SAMPLES; x++) {
+    rasterVSpan(buf, x, y0[x], y1[x]);
+  }
+  for (int x = 0; x < 3; x++) {
+    rasterPixel(buf, x, y0[0]);
+  }
+}
+
+// First differing byte of the display buffer against `ref`, or -1.
+static int bufferDiff(const uint8_t *ref) {
+  const uint8_t *buf = display.getBufferPtr();
+  for (int i = 0; i < SCREEN_W * DISPLAY_PAGES; i++) {
+    if (buf[i] != ref[i]) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+static void testRaster() {
+  static uint8_t ys1[RASTER_TRACES][SAMPLES];
+  static uint8_t ys2[RASTER_TRACES][SAMPLES];
+  uint8_t ref[SCREEN_W * DISPLAY_PAGES];
+
+  for (int i = 0; i < RASTER_TRACES; i++) {
+    randomTrace(ys1[i]);
+    randomTrace(ys2[i]);
+  }
+
+  int bad = 0;
+  int firstBad = -1;
+  for (int i = 0; i < RASTER_TRACES; i++) {
+    display.clearBuffer();
+    drawTracesU8g2(ys1[i], ys2[i]);
+    memcpy(ref, display.getBufferPtr(), sizeof(ref));
+    display.clearBuffer();
+    drawTracesRaster(ys1[i], ys2[i]);
+    int diff = bufferDiff(ref);
+
+    // Spans from the same data, ordered and on screen
+    uint8_t y0[SAMPLES];
+    uint8_t y1[SAMPLES];
+    for (int x = 0; x < SAMPLES; x++) {
+      uint8_t a = ys1[i][x] % SCREEN_H;
+      uint8_t b = ys2[i][x] % SCREEN_H;
+      y0[x] = (a < b) ? a : b;
+      y1[x] = (a < b) ? b : a;
+    }
+    display.clearBuffer();
+    drawSpansU8g2(y0, y1);
+    memcpy(ref, display.getBufferPtr(), sizeof(ref));
+    display.clearBuffer();
+    drawSpansRaster(y0, y1);
+    if (diff < 0) {
+      diff = bufferDiff(ref);
+    }
+
+    if (diff >= 0) {
+      if (bad++ == 0) {
+        firstBad = i;
+      }
+    }
+  }
+
+  // Host time per frame of both traces, for the ratio only
+  uint32_t t0 = hostNs();
+  for (int i = 0; i < RASTER_TRACES; i++) {
+    display.clearBuffer();
+    drawTracesU8g2(ys1[i], ys2[i]);
+  }
+  uint32_t t1 = hostNs();
+  for (int i = 0; i < RASTER_TRACES; i++) {
+    display.clearBuffer();
+    drawTracesRaster(ys1[i], ys2[i]);
+  }
+  uint32_t t2 = hostNs();
+
+  char detail[128];
+  if (bad == 0) {
+    snprintf(detail, sizeof(detail),
+             "%d trace and span frames bit-identical to U8g2; "
+             "%lu ns vs %lu ns per frame",
+             RASTER_TRACES, (unsigned long)((t2 - t1) / RASTER_TRACES),
+             (unsigned long)((t1 - t0) / RASTER_TRACES));
+  } else {
+    snprintf(detail, sizeof(detail), "%d of %d frames differ (first: #%d)",
+             bad, RASTER_TRACES, firstBad);
+  }
+  report("raster", bad == 0, detail);
+}
+
+// ── Spectrum (fft.h) ────────────────────────────────────────
+// Known sines through fftSpectrum(), checked against a double-precision
+// DFT of the same windowed samples: every displayed bin's level, the peak
+// bin, the interpolated peak frequency and the peak level.
+
+struct FftCase {
+  uint32_t freqMilliHz;
+  int32_t amplitude; // ADC codes, peak
+  int32_t offset;    // ADC codes around ADC_MID
+  int32_t drift;     // ADC codes of slow drift over the capture
+};
+
+static const uint32_t FFT_INTERVAL_US = 20; // 50 kHz, 195.3 Hz bins
+
+static const FftCase fftCases[] = {
+    {1000000, 2047, 0, 0},       // 0 dB, between bins
+    {3906250, 2047, 0, 0},       // 0 dB, on bin 20
+    {440000, 1024, 300, 0},      // -6 dB with a DC offset
+    {10000000, 205, -500, 0},    // -20 dB
+    {19726562, 20, 0, 0},        // -40 dB, between bins
+    {585937, 2047, 0, 0},        // low bin 3
+    {2500000, 400, 0, 1500},     // -14 dB on a large drift
+    {24800000, 1500, 0, 0},      // near Nyquist
+};
+
+// Reference level of every bin, dB below a full-scale sine.
+static void referenceSpectrum(const int16_t *x, double *db) {
+  const double pi = 3.14159265358979323846;
+  double mean = 0;
+  for (int n = 0; n < FFT_N; n++) {
+    mean += x[n];
+  }
+  mean /= FFT_N;
+  for (int k = 0; k < FFT_BINS; k++) {
+    double re = 0;
+    double im = 0;
+    for (int n = 0; n < FFT_N; n++) {
+      double w = sin(pi * n / FFT_N);
+      double v = (x[n] - mean) * 8 * w * w; // Q15 units, Hann
+      re += v * cos(2 * pi * k * n / FFT_N);
+      im -= v * sin(2 * pi * k * n / FFT_N);
+    }
+    double p = (re * re + im * im) / ((double)FFT_N * FFT_N);
+    // Full-scale sine: bin magnitude 4096, power 2^24
+    db[k] = (p > 0) ? 10 * log10(16777216.0 / p) : 999;
+  }
+}
+
+// How far a truncated whole-dB level is from a reference level, beyond the
+// 1 dB step itself.
+static double dbError(uint8_t db, double ref) {
+  if (ref < db) {
+    return db - ref;
+  }
+  return (ref > db + 1) ? ref - (db + 1) : 0.0;
+}
+
+static void testFft() {
+  const double binMilliHz = 1e9 / FFT_INTERVAL_US / FFT_N;
+  double worstDb = 0;
+  double worstBin = 0;
+  int bad = 0;
+  char detail[160] = "";
+
+  for (const FftCase &c : fftCases) {
+    int16_t x[FFT_N];
+    for (int n = 0; n < FFT_N; n++) {
+      double t = n * (FFT_INTERVAL_US * 1e-6);
+      double v = c.amplitude * sin(2 * 3.14159265358979 * c.freqMilliHz *
+                                   1e-3 * t) +
+                 c.offset + (double)c.drift * n / FFT_N;
+      x[n] = (int16_t)lround(ADC_MID + v);
+    }
+
+    Spectrum sp;
+    fftSpectrum(sp, x, FFT_INTERVAL_US);
+    double ref[FFT_BINS];
+    referenceSpectrum(x, ref);
+
+    // Displayed bins (within FFT_DB_RANGE) against the reference. The
+    // bottom 10 dB of the range is close to the fixed-point noise floor
+    // (65-70 dB down), so it is only checked loosely. Bins 0 and 1 only
+    // hold what the integer mean removal leaves of DC, and the peak search
+    // skips them.
+    for (int k = 2; k < FFT_BINS; k++) {
+      if (ref[k] >= FFT_DB_RANGE) {
+        continue;
+      }
+      double err = dbError(sp.db[k], ref[k]);
+      double allowed = (ref[k] < FFT_DB_RANGE - 10) ? 1.0 : 6.0;
+      if (ref[k] < FFT_DB_RANGE - 10 && err > worstDb) {
+        worstDb = err;
+      }
+      if (err > allowed) {
+        if (bad++ == 0) {
+          snprintf(detail, sizeof(detail),
+                   "%lu mHz: bin %d is %u dB, reference %.1f dB",
+                   (unsigned long)c.freqMilliHz, k, sp.db[k], ref[k]);
+        }
+      }
+    }
+
+    // Peak: the strongest reference bin above DC, its frequency to within
+    // a tenth of a bin and its level
+    int refBest = 2;
+    for (int k = 2; k < FFT_BINS; k++) {
+      if (ref[k] < ref[refBest]) {
+        refBest = k;
+      }
+    }
+    double binErr = fabs((double)sp.peakMilliHz - c.freqMilliHz) / binMilliHz;
+    worstBin = (binErr > worstBin) ? binErr : worstBin;
+    if (sp.peakBin != refBest || binErr > 0.1 ||
+        dbError(sp.peakDb, ref[refBest]) > 1.0) {
+      if (bad++ == 0) {
+        snprintf(detail, sizeof(detail),
+                 "%lu mHz: peak bin %u (reference %d) at %lu mHz, %u dB "
+                 "(reference %.1f dB)",
+                 (unsigned long)c.freqMilliHz, sp.peakBin, refBest,
+                 (unsigned long)sp.peakMilliHz, sp.peakDb, ref[refBest]);
+      }
+    }
+  }
+
+  // No tone: no peak
+  int16_t flat[FFT_N];
+  for (int n = 0; n < FFT_N; n++) {
+    flat[n] = ADC_MID + 100;
+  }
+  Spectrum sp;
+  fftSpectrum(sp, flat, FFT_INTERVAL_US);
+  if (sp.peakBin != 0 && bad++ == 0) {
+    snprintf(detail, sizeof(detail), "DC only: peak bin %u, expected none",
+             sp.peakBin);
+  }
+
+  if (bad == 0) {
+    snprintf(detail, sizeof(detail),
+             "%d sines: bins to -%d dB within %.1f dB of a reference DFT, "
+             "peak frequency within %.3f bin",
+             (int)(sizeof(fftCases) / sizeof(fftCases[0])),
+             FFT_DB_RANGE - 10, worstDb,
+             worstBin);
+  }
+  report("fft", bad == 0, detail);
+}
+
+// ── Equivalent-time sampling (ets.h) ────────────────────────
+// A sine with 5.5 samples per cycle, binned over many captures at random
+// phases. First with exactly known trigger positions, which isolates the
+// binning and merging (every bin filled, error within the bin quantisation
+// even after the hit counts have been halved many times); then through the
+// whole capture path, where triggerFind() measures the phase, against the
+// raw capture drawn at the same resolution.
+
+static const double ETS_PERIOD = 5.5; // samples per cycle
+static const int32_t ETS_AMPLITUDE = 1500;
+
+static double etsIdeal(double samplesAfterTrigger) {
+  const double pi = 3.14159265358979323846;
+  return ADC_MID + ETS_AMPLITUDE * sin(2 * pi * samplesAfterTrigger /
+                                       ETS_PERIOD);
+}
+
+// Largest and RMS error of a record against the ideal sine, with `pre`
+// fine bins before the trigger.
+static void etsError(const int16_t *rec, int pre, double &worst,
+                     double &rms) {
+  worst = 0;
+  rms = 0;
+  for (int b = 0; b < SAMPLES; b++) {
+    double e = fabs(rec[b] - etsIdeal((double)(b - pre) / ETS_FACTOR));
+    worst = (e > worst) ? e : worst;
+    rms += e * e;
+  }
+  rms = sqrt(rms / SAMPLES);
+}
+
+static void testEts() {
+  const int pre = (SAMPLES * TRIG_DEFAULT_PRETRIG) >> 8;
+  char detail[160];
+  int bad = 0;
+
+  // 1. Known trigger positions
+  static EtsRecord rec;
+  etsReset(rec);
+  int16_t buf1[CAPTURE_LEN];
+  int16_t buf2[CAPTURE_LEN];
+  int16_t out1[SAMPLES];
+  int16_t out2[SAMPLES];
+  int filledAt = 0;
+  int filled = 0;
+  for (int i = 0; i < 200; i++) {
+    int32_t trigQ8 = (int32_t)((pre + 1) * 256 + rnd(256 * 64));
+    for (int k = 0; k < CAPTURE_LEN; k++) {
+      double v = etsIdeal(k - trigQ8 / 256.0);
+      buf1[k] = (int16_t)lround(v);
+      buf2[k] = (int16_t)lround(2 * ADC_MID - v); // inverted copy
+    }
+    etsAdd(rec, buf1, buf2, CAPTURE_LEN, trigQ8, pre);
+    filled = etsRender(rec, out1, out2);
+    if (filledAt == 0 && filled == SAMPLES) {
+      filledAt = i + 1;
+    }
+  }
+  double worst;
+  double rms;
+  etsError(out1, pre, worst, rms);
+  double worst2;
+  double rms2;
+  for (int b = 0; b < SAMPLES; b++) {
+    out2[b] = (int16_t)(2 * ADC_MID - out2[b]);
+  }
+  etsError(out2, pre, worst2, rms2);
+  worst = (worst2 > worst) ? worst2 : worst;
+
+  // Rounding to the nearest fine bin moves a sample by up to half a bin
+  const double pi = 3.14159265358979323846;
+  double binLimit =
+      ETS_AMPLITUDE * 2 * pi / ETS_PERIOD / (2 * ETS_FACTOR) + 1;
+  if (filled != SAMPLES || worst > binLimit) {
+    bad++;
+    snprintf(detail, sizeof(detail),
+             "known phase: %d of %d bins filled, error %.0f codes "
+             "(limit %.0f)",
+             filled, SAMPLES, worst, binLimit);
+  }
+  double knownRms = rms;
+  int knownFilledAt = filledAt;
+
+  // 2. Through capture and trigger, as acquireFrame() runs it
+  static SigGenInputs inputs;
+  inputs.ch[0] = {SIG_SINE,
+                  (uint32_t)(1e9 / (ETS_PERIOD * TDIV_MIN_US)),
+                  ETS_AMPLITUDE * ADC_UV_PER_CODE / 1000, 0, 0, 0};
+  inputs.ch[1] = inputs.ch[0];
+  fakeAdcSetSignal(siggenFakeAdc, &inputs);
+  hostAnalog[PIN_TIMEDIV] = 0;    // fastest time base
+  hostAnalog[PIN_VOLTDIV] = 1755; // vscale 1.0
+  displayMode = MODE_ETS;
+  etsActive = false;
+
+  Frame &f = *frames.back();
+  double rawRms = 0;
+  filledAt = 0;
+  for (int i = 0; i < 64; i++) {
+    inputs.originNs += 1000000 + rnd(1000000);
+    if (!acquireFrame(f) || !f.triggered) {
+      continue;
+    }
+    if (filledAt == 0 && etsRender(etsRecord, out1, out2) == SAMPLES) {
+      filledAt = i + 1;
+    }
+    if (i == 0) {
+      // The raw capture at the same fine resolution: joined by straight
+      // lines, as the display draws it
+      int16_t raw[SAMPLES];
+      int32_t pos = triggerFind(captureBuf1, pre + 1,
+                                CAPTURE_LEN - SAMPLES + pre + 1, f.trig);
+      for (int b = 0; b < SAMPLES; b++) {
+        int32_t q8 = pos + ((b - pre) << 8) / ETS_FACTOR;
+        int k = q8 >> 8;
+        int w = q8 & 0xFF;
+        raw[b] = (int16_t)(captureBuf1[k] +
+                           ((captureBuf1[k + 1] - captureBuf1[k]) * w >> 8));
+      }
+      double rawWorst;
+      etsError(raw, pre, rawWorst, rawRms);
+    }
+  }
+  etsError(f.ch1, pre, worst, rms);
+  if (bad == 0 && (filledAt == 0 || rms >= rawRms / 2)) {
+    bad++;
+    snprintf(detail, sizeof(detail),
+             "captured: filled after %d captures, RMS error %.0f codes "
+             "(raw capture %.0f)",
+             filledAt, rms, rawRms);
+  }
+  fakeAdcSetSignal(nullptr, nullptr);
+  displayMode = MODE_SCOPE;
+
+  if (bad == 0) {
+    snprintf(detail, sizeof(detail),
+             "RMS error %.1f%% (known phase, full after %d), %.1f%% "
+             "captured (full after %d) vs %.1f%% raw",
+             100 * knownRms / ETS_AMPLITUDE, knownFilledAt,
+             100 * rms / ETS_AMPLITUDE, filledAt,
+             100 * rawRms / ETS_AMPLITUDE);
+  }
+  report("ets", bad == 0, detail);
+}
+
+// ── Trigger level control ───────────────────────────────────
+// Holding the trigger button and turning the V/div pot sets the level
+// (AUTO at the bottom), without changing V/div or counting as a press; after
+// the release V/div only follows the pot again once it is back where it was.
+static void testTriggerLevel() {
+  SigGenInputs in = {};
+  in.ch[0] = {SIG_SINE, 1000000, 3000, 0, 0, 0};
+  fakeAdcSetSignal(siggenFakeAdc, &in);
+  hostAnalog[PIN_TIMEDIV] = 0;
+  hostAnalog[PIN_VOLTDIV] = 1755;
+  TriggerConfig saved = trigCfg;
+  trigCfg = triggerDefaults();
+
+  Frame &f = *frames.back();
+  bool ok = true;
+  char detail[96] = "";
+  auto step = [&](int pot, bool held) {
+    hostAnalog[PIN_VOLTDIV] = pot;
+    hostPressed[PIN_TRIG_BTN] = held;
+    pollButtons();
+    in.originNs += 1234567;
+    acquireFrame(f);
+  };
+  auto check = [&](bool cond, const char *what) {
+    if (ok && !cond) {
+      ok = false;
+      snprintf(detail, sizeof(detail), "%s", what);
+    }
+  };
+
+  step(1755, false);
+  float vdiv = f.vdivScale;
+  TriggerMode mode = trigCfg.mode;
+
+  step(1755, true); // held, pot still: nothing changes yet
+  check(trigCfg.level == TRIG_LEVEL_AUTO && !f.levelAdjust,
+        "level changed without moving the pot");
+  step(3000, true);
+  int16_t want = levelFromPot(3000);
+  check(trigCfg.level == want && f.levelAdjust, "level not taken from the pot");
+  check(f.vdivScale == vdiv, "V/div followed the pot while setting the level");
+  check(f.trig.level == want && f.trig.hysteresis > TRIG_DEFAULT_HYST,
+        "manual level not used, or hysteresis not widened");
+  usleep((BUTTON_DEBOUNCE_MS + 10) * 1000); // long enough to be a press
+  step(3000, false);
+  check(trigCfg.mode == mode, "release after setting the level counted as a press");
+  check(f.vdivScale == vdiv && !f.levelAdjust, "V/div jumped after the release");
+  step(1755 + POT_DEADBAND, false);
+  step(1000, false);
+  check(f.vdivScale < vdiv, "V/div did not pick the pot up again");
+
+  step(1000, true);
+  step(0, true);
+  check(trigCfg.level == TRIG_LEVEL_AUTO, "bottom of the pot is not AUTO");
+  step(0, false);
+
+  if (ok) {
+    snprintf(detail, sizeof(detail),
+             "level from the V/div pot while held, AUTO at 0, V/div picked up "
+             "after release");
+  }
+  report("triglvl", ok, detail);
+
+  trigCfg = saved;
+  hostAnalog[PIN_VOLTDIV] = 1755;
+  fakeAdcSetSignal(nullptr, nullptr);
+}
+
+// ── Stream loopback (stream.h, stream_reader.py) ────────────
+// `scope_test --stream PREFIX` captures STREAM_FRAMES scope frames with the
+// serial port open on PREFIX.bin, so streamCapture() writes real frames,
+// and lists what they must decode to in PREFIX.csv: every raw ADC word, as
+// the fake ADC produced it, and the trigger index. host/stream_loopback.py
+// runs this and checks stream_reader.py's output against the list.
+
+static const int STREAM_FRAMES = 16;
+
+static int streamLoopback(const char *prefix) {
+  char path[256];
+  snprintf(path, sizeof(path), "%s.bin", prefix);
+  Serial.out = fopen(path, "wb");
+  snprintf(path, sizeof(path), "%s.csv", prefix);
+  FILE *ref = fopen(path, "w");
+  if (Serial.out == nullptr || ref == nullptr) {
+    fprintf(stderr, "cannot write %s.*\n", prefix);
+    return 1;
+  }
+
+  static SigGenInputs inputs;
+  inputs.ch[0] = {SIG_SINE, 1000000, 4000, 0, 0, 0};
+  inputs.ch[1] = {SIG_SQUARE, 300000, 3000, 500, 0, 0};
+  fakeAdcSetSignal(siggenFakeAdc, &inputs);
+  hostAnalog[PIN_TIMEDIV] = 0; // 20 us: sampled, streamed
+  hostAnalog[PIN_VOLTDIV] = 1755;
+  displayMode = MODE_SCOPE;
+
+  const uint32_t words = 2 * CAPTURE_LEN;
+  const uint32_t periodNs = TDIV_MIN_US * 1000 / 2; // per conversion
+  const int pre = (SAMPLES * TRIG_DEFAULT_PRETRIG) >> 8;
+  fprintf(ref, "seq,index,trigger,ch1,ch2\n");
+  for (int seq = 0; seq < STREAM_FRAMES; seq++) {
+    inputs.originNs += 1000000 + rnd(1000000);
+    acquireFrame(*frames.back());
+
+    // The frame ends at the newest conversion (DMA bursts are whole pairs)
+    uint32_t first = fakeAdcSampleCount() - words;
+    int32_t pos = triggerFind(
+        trigCfg.source == 0 ? captureBuf1 : captureBuf2, pre + 1,
+        CAPTURE_LEN - SAMPLES + pre + 1,
+        triggerResolve(trigCfg,
+                       trigCfg.source == 0 ? captureBuf1 : captureBuf2,
+                       CAPTURE_LEN));
+    int trig = (pos >= 0) ? (int)(pos >> 8) : -1;
+    for (uint32_t i = 0; i < CAPTURE_LEN; i++) {
+      uint16_t c1 = siggenFakeAdc(PIN_CH1 - ADC_FIRST_PIN, first + 2 * i,
+                                  periodNs, &inputs);
+      uint16_t c2 = siggenFakeAdc(PIN_CH2 - ADC_FIRST_PIN, first + 2 * i + 1,
+                                  periodNs, &inputs);
+      fprintf(ref, "%d,%lu,%d,%u,%u\n", seq, (unsigned long)i,
+              (int)i == trig ? 1 : 0, c1, c2);
+    }
+  }
+
+  fclose(ref);
+  fclose(Serial.out);
+  Serial.out = nullptr;
+  fakeAdcSetSignal(nullptr, nullptr);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  setup1();
+  setup();
+
+  if (argc == 3 && strcmp(argv[1], "--stream") == 0) {
+    return streamLoopback(argv[2]);
+  }
+  if (argc != 1) {
+    fprintf(stderr, "usage: %s [--stream PREFIX]\n", argv[0]);
+    return 1;
+  }
+
+  testRaster();
+  testFft();
+  testEts();
+  testTriggerLevel();
+
+  if (failures > 0) {
+    printf("%d test(s) failed\n", failures);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,18 @@
+#include "average.h"
+
+void averageReset(Averager &a) { a.shift = 0; }
+
+void averageTrace(Averager &a, int t, int16_t *trace) {
+  int32_t *acc = a.acc[t];
+  const int shift = a.shift;
+  for (int x = 0; x < SAMPLES; x++) {
+    acc[x] += (((int32_t)trace[x] << AVERAGE_FRAC) - acc[x]) >> shift;
+    trace[x] = (int16_t)((acc[x] + (1 << (AVERAGE_FRAC - 1))) >> AVERAGE_FRAC);
+  }
+}
+
+void averageNext(Averager &a) {
+  if (a.shift < AVERAGE_SHIFT) {
+    a.shift++;
+  }
+}
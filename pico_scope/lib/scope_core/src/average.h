@@ -0,0 +1,35 @@
+#ifndef AVERAGE_H
+#define AVERAGE_H
+
+#include <stdint.h>
+
+#include "config.h"
+
+// ── Averaging ───────────────────────────────────────────────
+// Per-column exponential average of triggered frames to pull repetitive
+// signals out of noise. Each trace keeps a Q(AVERAGE_FRAC) accumulator per
+// column, updated with an integer IIR:
+//
+//   acc += ((x << AVERAGE_FRAC) - acc) >> shift
+//
+// The shift ramps up from 0 to AVERAGE_SHIFT over the first frames after a
+// reset, so the average settles quickly instead of fading in from zero.
+
+#define AVERAGE_FRAC 8
+#define AVERAGE_TRACES 6 // ch1, ch2 and both peak envelopes
+
+struct Averager {
+  int32_t acc[AVERAGE_TRACES][SAMPLES];
+  uint8_t shift; // current IIR shift (ramps up to AVERAGE_SHIFT)
+};
+
+void averageReset(Averager &a);
+
+// Blend `trace` (SAMPLES values) into accumulator `t` and replace it with
+// the running average.
+void averageTrace(Averager &a, int t, int16_t *trace);
+
+// Advance the ramp once per averaged frame, after all of its traces.
+void averageNext(Averager &a);
+
+#endif // AVERAGE_H
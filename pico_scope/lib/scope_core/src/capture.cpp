@@ -0,0 +1,92 @@
+#include "capture.h"
+#include "config.h"
+
+CaptureTiming captureTiming(uint32_t intervalUs, uint8_t channels) {
+  CaptureTiming t;
+  uint32_t total = intervalUs * ADC_CLOCK_MHZ / channels;
+
+  t.intervalUs = intervalUs;
+  t.channels = channels;
+  t.oversample = (uint16_t)((total + ADC_MAX_CYCLES - 1) / ADC_MAX_CYCLES);
+  if (t.oversample == 0) {
+    t.oversample = 1;
+  }
+  t.cycles = total / t.oversample;
+  if (t.cycles < ADC_MIN_CYCLES) {
+    t.cycles = ADC_MIN_CYCLES;
+  }
+  return t;
+}
+
+uint32_t captureWait(uint32_t from, uint32_t count) {
+  // The head is a ring index, so accumulate small steps. This stays exact as
+  // long as we poll at least once per ring period (8 ms at 500 ksps).
+  uint32_t last = from;
+  uint32_t seen = 0;
+  while (seen < count) {
+    uint32_t head = captureHead();
+    seen += (head - last) & CAPTURE_RING_MASK;
+    last = head;
+  }
+  return last;
+}
+
+void captureCopy(int16_t *dst, uint32_t end, uint32_t count,
+                 uint16_t oversample) {
+  const volatile uint16_t *ring = captureRing();
+  uint32_t idx = (end - count * oversample) & CAPTURE_RING_MASK;
+
+  if (oversample <= 1) {
+    for (uint32_t i = 0; i < count; i++) {
+      dst[i] = ADC_MAX - (int16_t)ring[idx];
+      idx = (idx + 1) & CAPTURE_RING_MASK;
+    }
+    return;
+  }
+
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t sum = 0;
+    for (uint16_t k = 0; k < oversample; k++) {
+      sum += ring[idx];
+      idx = (idx + 1) & CAPTURE_RING_MASK;
+    }
+    dst[i] = ADC_MAX - (int16_t)(sum / oversample);
+  }
+}
+
+// CH2 is converted one ADC conversion after CH1, i.e. skewQ8/256 of an
+// output sample late. Interpolate each sample back towards the previous
+// one; the first sample is extrapolated from the second.
+static void deskew(int16_t *s, uint32_t count, int32_t skewQ8) {
+  if (count < 2 || skewQ8 == 0) {
+    return;
+  }
+  int32_t first = s[0] - (((s[1] - s[0]) * skewQ8) >> 8);
+  for (uint32_t i = count - 1; i > 0; i--) {
+    s[i] -= (int16_t)(((s[i] - s[i - 1]) * skewQ8) >> 8);
+  }
+  s[0] = (int16_t)(first < 0 ? 0 : (first > ADC_MAX ? ADC_MAX : first));
+}
+
+void captureCopyDual(int16_t *dst1, int16_t *dst2, uint32_t end,
+                     uint32_t count, uint16_t oversample) {
+  const volatile uint16_t *ring = captureRing();
+  end &= ~1u; // whole pairs only
+  uint32_t idx = (end - 2 * count * oversample) & CAPTURE_RING_MASK;
+
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t sum1 = 0;
+    uint32_t sum2 = 0;
+    for (uint16_t k = 0; k < oversample; k++) {
+      sum1 += ring[idx];
+      sum2 += ring[idx + 1]; // idx is even, so this never wraps
+      idx = (idx + 2) & CAPTURE_RING_MASK;
+    }
+    dst1[i] = ADC_MAX - (int16_t)(sum1 / oversample);
+    dst2[i] = ADC_MAX - (int16_t)(sum2 / oversample);
+  }
+
+  // Averaging keeps the one-conversion lag, which is 1/(2 * oversample) of
+  // an output sample.
+  deskew(dst2, count, 128 / oversample);
+}
@@ -0,0 +1,83 @@
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+#include <stdint.h>
+
+// ── Capture engine ──────────────────────────────────────────
+// The ADC runs free at a hardware-paced rate and DMA streams every
+// conversion into a circular buffer of CAPTURE_RING_LEN samples. The CPU
+// only looks at the write position, so it is free while samples arrive.
+//
+// With two channels the ADC round-robins between the inputs, so the ring
+// holds interleaved pairs (CH1 in even slots, CH2 in odd slots) and the two
+// channels share one sample clock, CH2 one conversion behind CH1.
+//
+// On the Pico this is backed by the RP2040 ADC FIFO + two DMA channels
+// (capture_rp2040.cpp). On a host build the same API is backed by a fake
+// ADC (capture_fake.cpp) so capture and trigger logic can run on Linux.
+
+// Hardware timing derived from a requested sample interval.
+struct CaptureTiming {
+  uint32_t intervalUs; // requested interval between displayed samples
+  uint32_t cycles;     // ADC clock cycles between hardware samples
+  uint16_t oversample; // hardware samples averaged per displayed sample
+  uint8_t channels;    // inputs converted in turn (1 or 2)
+};
+
+// Split an interval into an ADC divider and an oversampling factor. With
+// two channels each conversion gets half the interval.
+CaptureTiming captureTiming(uint32_t intervalUs, uint8_t channels = 1);
+
+// Claim DMA channels and set up the ADC FIFO (call once from setup()).
+void captureBegin();
+
+// Start free-running conversions of one ADC input at the given timing.
+// The ring restarts at index 0.
+void captureStart(uint8_t pin, const CaptureTiming &timing);
+
+// Same with two inputs converted alternately (round-robin), `pin1` first,
+// so interleaved pairs always start on an even ring index.
+void captureStartDual(uint8_t pin1, uint8_t pin2, const CaptureTiming &timing);
+
+// Stop conversions so the ADC can be shared (e.g. with analogRead()).
+// The DMA ring keeps its contents until the next start.
+void captureStop();
+
+// Ring buffer and current write index (next slot DMA will fill).
+const volatile uint16_t *captureRing();
+uint32_t captureHead();
+
+// Block until `count` samples have been written after ring index `from`.
+// Returns the ring index just past the newest sample.
+uint32_t captureWait(uint32_t from, uint32_t count);
+
+// Copy the newest `count` displayed samples ending at ring index `end`
+// into dst, averaging `oversample` hardware samples per output sample and
+// inverting (the input stage is inverting). count * oversample must fit in
+// the ring with room to spare.
+void captureCopy(int16_t *dst, uint32_t end, uint32_t count,
+                 uint16_t oversample);
+
+// Dual-channel captureCopy: de-interleave the newest `count` pairs (after
+// oversampling) ending at or before ring index `end` and re-align CH2 onto
+// CH1's sample instants by fractional interpolation.
+void captureCopyDual(int16_t *dst1, int16_t *dst2, uint32_t end,
+                     uint32_t count, uint16_t oversample);
+
+#ifndef ARDUINO
+// ── Host fake ADC ───────────────────────────────────────────
+// Signal callback: returns the raw 12-bit code of ADC input `input` for
+// absolute sample number `n`, taken `periodNs` apart.
+typedef uint16_t (*FakeAdcSignal)(uint8_t input, uint32_t n,
+                                  uint32_t periodNs, void *ctx);
+
+void fakeAdcSetSignal(FakeAdcSignal signal, void *ctx);
+
+// Emulate DMA writing `count` more conversions into the ring.
+void fakeAdcPump(uint32_t count);
+
+// Samples written since the last captureStart().
+uint32_t fakeAdcSampleCount();
+#endif
+
+#endif // CAPTURE_H
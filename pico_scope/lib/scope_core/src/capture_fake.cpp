@@ -0,0 +1,75 @@
+#if !defined(ARDUINO)
+
+#include "capture.h"
+#include "config.h"
+
+// Host stand-in for the RP2040 ADC + DMA ring. Conversions are produced on
+// demand: every captureHead() poll "lets DMA run" for FAKE_ADC_BURST samples,
+// so captureWait() makes progress exactly like on hardware.
+#define FAKE_ADC_BURST 16
+
+static uint16_t ring[CAPTURE_RING_LEN];
+static uint32_t head = 0;
+static bool running = false;
+static uint8_t inputs[2] = {0, 0};
+static uint8_t channels = 1;
+static uint32_t periodNs = 0;
+static uint32_t sampleCount = 0;
+
+static FakeAdcSignal signalFn = nullptr;
+static void *signalCtx = nullptr;
+
+void fakeAdcSetSignal(FakeAdcSignal signal, void *ctx) {
+  signalFn = signal;
+  signalCtx = ctx;
+}
+
+void fakeAdcPump(uint32_t count) {
+  if (!running) {
+    return;
+  }
+  for (uint32_t i = 0; i < count; i++) {
+    uint8_t input = inputs[sampleCount % channels];
+    uint16_t code = signalFn ? signalFn(input, sampleCount, periodNs, signalCtx)
+                             : (uint16_t)ADC_MID;
+    ring[head] = code & ADC_MAX;
+    head = (head + 1) & CAPTURE_RING_MASK;
+    sampleCount++;
+  }
+}
+
+uint32_t fakeAdcSampleCount() { return sampleCount; }
+
+void captureBegin() {
+  for (uint32_t i = 0; i < CAPTURE_RING_LEN; i++) {
+    ring[i] = ADC_MID;
+  }
+  head = 0;
+}
+
+void captureStart(uint8_t pin, const CaptureTiming &timing) {
+  captureStartDual(pin, pin, timing);
+  channels = 1;
+}
+
+void captureStartDual(uint8_t pin1, uint8_t pin2,
+                      const CaptureTiming &timing) {
+  inputs[0] = pin1 - ADC_FIRST_PIN;
+  inputs[1] = pin2 - ADC_FIRST_PIN;
+  channels = 2;
+  periodNs = timing.cycles * 1000 / ADC_CLOCK_MHZ;
+  head = 0; // the DMA ring restarts at index 0 like on hardware
+  sampleCount = 0;
+  running = true;
+}
+
+void captureStop() { running = false; }
+
+const volatile uint16_t *captureRing() { return ring; }
+
+uint32_t captureHead() {
+  fakeAdcPump(FAKE_ADC_BURST);
+  return head;
+}
+
+#endif // !ARDUINO
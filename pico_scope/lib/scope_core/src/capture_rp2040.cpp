@@ -0,0 +1,112 @@
+#if defined(ARDUINO_ARCH_RP2040)
+
+#include "capture.h"
+#include "config.h"
+
+#include "hardware/adc.h"
+#include "hardware/dma.h"
+
+// DMA ring: the write address wraps on a CAPTURE_RING_LEN * 2 byte boundary,
+// so the buffer has to be aligned to its own size.
+static uint16_t ring[CAPTURE_RING_LEN]
+    __attribute__((aligned(CAPTURE_RING_LEN * sizeof(uint16_t))));
+
+// The data channel moves ADC FIFO → ring. When its transfer count runs out
+// it chains to the control channel, which writes the count back and
+// retriggers it, so the capture never stops on its own.
+static int dataChan = -1;
+static int ctrlChan = -1;
+static uint32_t reloadCount = 0xFFFFFFFFu;
+static dma_channel_config dataCfg;
+
+void captureBegin() {
+  dataChan = dma_claim_unused_channel(true);
+  ctrlChan = dma_claim_unused_channel(true);
+
+  dataCfg = dma_channel_get_default_config(dataChan);
+  channel_config_set_transfer_data_size(&dataCfg, DMA_SIZE_16);
+  channel_config_set_read_increment(&dataCfg, false);
+  channel_config_set_write_increment(&dataCfg, true);
+  channel_config_set_ring(&dataCfg, true, CAPTURE_RING_BITS + 1); // bytes
+  channel_config_set_dreq(&dataCfg, DREQ_ADC);
+  channel_config_set_chain_to(&dataCfg, ctrlChan);
+  dma_channel_configure(dataChan, &dataCfg, ring, &adc_hw->fifo, reloadCount,
+                        false);
+
+  dma_channel_config cc = dma_channel_get_default_config(ctrlChan);
+  channel_config_set_transfer_data_size(&cc, DMA_SIZE_32);
+  channel_config_set_read_increment(&cc, false);
+  channel_config_set_write_increment(&cc, false);
+  dma_channel_configure(ctrlChan, &cc,
+                        &dma_hw->ch[dataChan].al1_transfer_count_trig,
+                        &reloadCount, 1, false);
+
+  // Arm the data channel; it only moves when the ADC FIFO raises DREQ.
+  dma_channel_start(dataChan);
+}
+
+// Point the data channel back at ring[0]. The ADC is stopped, so the channel
+// is only waiting on DREQ. Chaining is switched off around the abort, as an
+// aborted channel can still fire its chain (RP2040-E13).
+static void rewindRing() {
+  channel_config_set_chain_to(&dataCfg, dataChan);
+  dma_channel_set_config(dataChan, &dataCfg, false);
+  dma_channel_abort(dataChan);
+  channel_config_set_chain_to(&dataCfg, ctrlChan);
+  dma_channel_configure(dataChan, &dataCfg, ring, &adc_hw->fifo, reloadCount,
+                        true);
+}
+
+static void startConversions(const CaptureTiming &timing) {
+  // Divider is 16.8 fixed point: a sample every (1 + div) ADC cycles.
+  adc_hw->div = (timing.cycles - 1) << ADC_DIV_INT_LSB;
+
+  adc_fifo_setup(true,  // write conversions to the FIFO
+                 true,  // raise DREQ for DMA
+                 1,     // DREQ as soon as one sample is ready
+                 false, // no error bit in the sample
+                 false  // keep full 12-bit samples
+  );
+  adc_fifo_drain();
+  rewindRing();
+  adc_run(true);
+}
+
+void captureStart(uint8_t pin, const CaptureTiming &timing) {
+  adc_gpio_init(pin);
+  adc_select_input(pin - ADC_FIRST_PIN);
+  adc_set_round_robin(0);
+  startConversions(timing);
+}
+
+void captureStartDual(uint8_t pin1, uint8_t pin2,
+                      const CaptureTiming &timing) {
+  adc_gpio_init(pin1);
+  adc_gpio_init(pin2);
+  // Round-robin steps to the next enabled input after each conversion, so
+  // with two inputs enabled it alternates, starting from the selected one.
+  adc_select_input(pin1 - ADC_FIRST_PIN);
+  adc_set_round_robin((1u << (pin1 - ADC_FIRST_PIN)) |
+                      (1u << (pin2 - ADC_FIRST_PIN)));
+  startConversions(timing);
+}
+
+void captureStop() {
+  adc_run(false);
+  while (!(adc_hw->cs & ADC_CS_READY_BITS)) {
+    tight_loop_contents();
+  }
+  // Disable the FIFO so one-shot analogRead() conversions don't end up in
+  // the ring.
+  adc_fifo_setup(false, false, 0, false, false);
+  adc_fifo_drain();
+}
+
+const volatile uint16_t *captureRing() { return ring; }
+
+uint32_t captureHead() {
+  uint32_t addr = dma_hw->ch[dataChan].write_addr;
+  return ((addr - (uint32_t)ring) / sizeof(uint16_t)) & CAPTURE_RING_MASK;
+}
+
+#endif // ARDUINO_ARCH_RP2040
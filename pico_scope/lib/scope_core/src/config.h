@@ -0,0 +1,134 @@
+#ifndef CONFIG_H
+#define CONFIG_H
+
+// ── ADC pins ────────────────────────────────────────────────
+#define PIN_CH1 28     // GP28 (A2)
+#define PIN_CH2 29     // GP29 (A3)
+#define PIN_TIMEDIV 26 // GP26 (A0)
+#define PIN_VOLTDIV 27 // GP27 (A1)
+#define ADC_FIRST_PIN 26 // GP26 is ADC input 0
+
+// Pot readings must move by more than this before a new value is used,
+// so ADC noise doesn't keep changing the scale (and rebuilding tables).
+#define POT_DEADBAND 8
+
+// ── Buttons (to GND, internal pull-up) ──────────────────────
+#define PIN_TRIG_BTN 14   // GP14: trigger mode / re-arm, hold for slope+source
+#define PIN_MODE_BTN 13   // GP13: display mode (SCOPE, AVG, ..., FFT)
+#define BUTTON_LONG_MS 600
+#define BUTTON_DEBOUNCE_MS 20
+
+// ── Oscilloscope settings ───────────────────────────────────
+#define SCREEN_W 128
+#define SCREEN_H 64
+#define STATUS_Y 5                           // Y position for T/V text at top
+#define MEASURE_BAR_Y (SCREEN_H - 1)         // measurement bar at the bottom
+#define MEASURE_BAR_H 7
+#define WAVEFORM_TOP 8                       // top of waveform area (pixels)
+#define WAVEFORM_H (SCREEN_H - WAVEFORM_TOP) // waveform height in pixels
+#define SAMPLES SCREEN_W                     // one sample per horizontal pixel
+
+// Vertical scaling: assume at vdiv_scale = 1.0 the screen shows 10 Vpp.
+// With 8 vertical divisions, that means 10/8 V per division at vdiv_scale = 1.0.
+// At other scales, V/div is (BASE_VPP_AT_VSCALE_1 * vdiv_scale) / VERTICAL_DIVS.
+#define VERTICAL_DIVS 8
+#define BASE_VPP_AT_VSCALE_1 10.0f
+
+// ADC mid-scale (Pico = 12-bit → 0–4095, mid = ~2048)
+// After op-amp conditioning a 0V eurorack signal should land here
+#define ADC_MID 2048
+#define ADC_MAX 4095
+
+// Calibration for measurements, consistent with the display: at
+// vdiv_scale = 1.0 the ±(ADC_MAX / 2) codes around ADC_MID fill the screen,
+// i.e. BASE_VPP_AT_VSCALE_1 volts.
+#define ADC_UV_PER_CODE \
+  ((int32_t)(BASE_VPP_AT_VSCALE_1 * 1000000.0f / (2 * (ADC_MAX / 2))))
+
+// Time/Div range : min and max microseconds between samples
+#define TDIV_MIN_US 20
+#define TDIV_MAX_US 5000
+
+// Trigger: search window in samples
+#define TRIGGER_SEARCH 512 // max samples to scan for trigger
+
+// Trigger defaults (see trigger.h). Level is "auto" (50 % of the signal's
+// peak-to-peak) unless TRIG_DEFAULT_LEVEL is set to an ADC code.
+#define TRIG_LEVEL_AUTO -1
+#define TRIG_DEFAULT_LEVEL TRIG_LEVEL_AUTO
+#define TRIG_DEFAULT_HYST 24      // ADC codes (~60 mV at the input)
+#define TRIG_AUTO_HYST_SHIFT 3    // auto level: hysteresis >= p-p / 8
+#define TRIG_DEFAULT_PRETRIG 64   // fraction of the window before the trigger, /256
+#define TRIG_AUTO_TIMEOUT_MS 100  // auto mode free-runs after this long
+// Level set with the V/div pot while the trigger button is held: AUTO below
+// this pot reading, ADC codes 0..ADC_MAX over the rest of the travel
+#define TRIG_POT_AUTO 128
+
+// ── Capture engine ──────────────────────────────────────────
+// The ADC free-runs into a circular buffer written by DMA. The ring must be
+// a power of two (DMA address wrapping) and hold a full oversampled capture
+// plus some slack, since DMA keeps writing while the frame is copied out.
+#define CAPTURE_RING_BITS 12
+#define CAPTURE_RING_LEN (1u << CAPTURE_RING_BITS) // samples
+#define CAPTURE_RING_MASK (CAPTURE_RING_LEN - 1)
+
+// ADC clock is 48 MHz and one conversion takes 96 cycles (500 ksps max).
+// The clock divider is 16 bits wide, so the slowest hardware rate is one
+// sample every 65536 cycles (~1.37 ms). Slower time bases average several
+// hardware samples per displayed sample.
+#define ADC_CLOCK_MHZ 48
+#define ADC_MIN_CYCLES 96
+#define ADC_MAX_CYCLES 65536
+
+// Peak detect: from this sample interval up, the ADC runs at full rate and
+// each displayed column shows the min/max of the samples it covers.
+#define PEAK_DETECT_MIN_US 50
+
+// Roll mode: from this sample interval up the display scrolls untriggered
+// instead of waiting for a full capture, refreshing every ROLL_FRAME_MS.
+#define ROLL_MIN_US 500
+#define ROLL_FRAME_MS 40
+
+// Averaging mode: each new frame is weighted 1 / 2^AVERAGE_SHIFT
+#define AVERAGE_SHIFT 3
+
+// Persistence mode: intensity kept per frame, /256 (224: time constant of
+// 8 frames, ~0.4 s at 20 fps)
+#define PERSIST_DECAY 224
+
+// Equivalent-time mode: fine bins per ADC sample, and hits a bin keeps
+// before its history is halved
+#define ETS_FACTOR 8
+#define ETS_BIN_MAX 8
+
+// Segmented memory: up to SEG_COUNT triggered segments of SAMPLES samples,
+// SEG_PRE of them before the trigger. A burst ends when memory is full or
+// no trigger arrives for SEG_TIMEOUT_MS.
+#define SEG_COUNT 32
+#define SEG_PRE 16
+#define SEG_TIMEOUT_MS 1000
+
+// Spectrum mode: dB range shown over the waveform area height
+#define FFT_DB_RANGE 60
+
+// ── Diagnostics ─────────────────────────────────────────────
+// Print the display frame rate and bytes per frame over USB serial
+#define DISPLAY_STATS_SERIAL 0
+
+// Stream raw captures to a host over USB serial (see stream.h and
+// stream_reader.py). Turn DISPLAY_STATS_SERIAL off while streaming, its text
+// would only cost the reader a few dropped frames.
+#define STREAM_SERIAL 1
+
+// Time the frame pipeline stages over the last PROFILE_FRAMES frames (see
+// profile.h). Hold the mode button to toggle the overlay; the summary is
+// also printed over USB serial once a second unless STREAM_SERIAL is on
+// (the text would be written from core0 in the middle of core1's binary
+// frames), so turn streaming off to log it. 0 compiles the hooks away.
+// The host benchmark turns it on from the command line.
+#ifndef PROFILE_ENABLED
+#define PROFILE_ENABLED 0
+#endif
+#define PROFILE_FRAMES 32
+
+#endif // CONFIG_H
@@ -0,0 +1,41 @@
+#include "dirty.h"
+
+void dirtyInit(DirtyTracker &t) { t.valid = false; }
+
+uint32_t dirtyScan(DirtyTracker &t, const uint8_t *buf, DirtySpan *spans) {
+  uint32_t bytes = 0;
+
+  for (int p = 0; p < DISPLAY_PAGES; p++) {
+    const uint8_t *row = buf + p * SCREEN_W;
+    uint8_t *sent = t.sent + p * SCREEN_W;
+
+    int first = 0;
+    int last = SCREEN_W - 1;
+    if (t.valid) {
+      while (first < SCREEN_W && row[first] == sent[first]) {
+        first++;
+      }
+      if (first == SCREEN_W) {
+        spans[p].tx = 0;
+        spans[p].tw = 0;
+        continue;
+      }
+      while (row[last] == sent[last]) {
+        last--;
+      }
+    }
+
+    int tx0 = first >> 3;
+    int tx1 = last >> 3;
+    spans[p].tx = (uint8_t)tx0;
+    spans[p].tw = (uint8_t)(tx1 - tx0 + 1);
+
+    for (int x = tx0 * 8; x < (tx1 + 1) * 8; x++) {
+      sent[x] = row[x];
+    }
+    bytes += (tx1 - tx0 + 1) * 8;
+  }
+
+  t.valid = true;
+  return bytes;
+}
@@ -0,0 +1,34 @@
+#ifndef DIRTY_H
+#define DIRTY_H
+
+#include <stdint.h>
+
+#include "config.h"
+
+// ── Dirty-page tracking ─────────────────────────────────────
+// The SH1106 is written page by page (8 rows × SCREEN_W columns). Keeping a
+// copy of the last transmitted frame lets us send only the pages, and the
+// tile (8-column) range within each page, that actually changed.
+
+#define DISPLAY_PAGES (SCREEN_H / 8)
+#define DISPLAY_TILES (SCREEN_W / 8)
+
+// Changed tile range of one page; tw = 0 when the page is clean.
+struct DirtySpan {
+  uint8_t tx; // first changed tile
+  uint8_t tw; // number of tiles to send
+};
+
+struct DirtyTracker {
+  uint8_t sent[DISPLAY_PAGES * SCREEN_W]; // what the display shows now
+  bool valid; // false until a full frame has been sent
+};
+
+void dirtyInit(DirtyTracker &t);
+
+// Compare a page-ordered frame buffer with the last transmitted one, fill
+// one span per page and record the changed bytes as sent. Returns the
+// number of bytes that have to be transmitted.
+uint32_t dirtyScan(DirtyTracker &t, const uint8_t *buf, DirtySpan *spans);
+
+#endif // DIRTY_H
@@ -0,0 +1,77 @@
+#include "ets.h"
+
+void etsReset(EtsRecord &r) {
+  for (int b = 0; b < SAMPLES; b++) {
+    r.sum1[b] = 0;
+    r.sum2[b] = 0;
+    r.hits[b] = 0;
+  }
+}
+
+void etsAdd(EtsRecord &r, const int16_t *buf1, const int16_t *buf2, int len,
+            int32_t trigQ8, int pre) {
+  // Capture samples that can reach the record: pre / ETS_FACTOR before the
+  // trigger to (SAMPLES - pre) / ETS_FACTOR after it, plus one for rounding.
+  int k0 = (trigQ8 >> 8) - pre / ETS_FACTOR - 1;
+  int k1 = (trigQ8 >> 8) + (SAMPLES - pre) / ETS_FACTOR + 2;
+  if (k0 < 0) {
+    k0 = 0;
+  }
+  if (k1 > len) {
+    k1 = len;
+  }
+
+  for (int k = k0; k < k1; k++) {
+    // Fine bin of sample k, rounded to nearest: pre + (k - trig) * N
+    int32_t t = (((int32_t)k << 8) - trigQ8) * ETS_FACTOR + 128;
+    int b = pre + (t >> 8);
+    if (b < 0 || b >= SAMPLES) {
+      continue;
+    }
+    if (r.hits[b] >= ETS_BIN_MAX) {
+      r.sum1[b] >>= 1;
+      r.sum2[b] >>= 1;
+      r.hits[b] >>= 1;
+    }
+    r.sum1[b] += buf1[k];
+    r.sum2[b] += buf2[k];
+    r.hits[b]++;
+  }
+}
+
+int etsRender(const EtsRecord &r, int16_t *out1, int16_t *out2) {
+  int filled = 0;
+  int last = -1; // last filled bin
+
+  for (int b = 0; b < SAMPLES; b++) {
+    if (r.hits[b] == 0) {
+      continue;
+    }
+    out1[b] = (int16_t)(r.sum1[b] / r.hits[b]);
+    out2[b] = (int16_t)(r.sum2[b] / r.hits[b]);
+    filled++;
+
+    if (last < 0) {
+      // Leading gap: hold the first value
+      for (int g = 0; g < b; g++) {
+        out1[g] = out1[b];
+        out2[g] = out2[b];
+      }
+    } else {
+      int span = b - last;
+      for (int g = last + 1; g < b; g++) {
+        int w = g - last;
+        out1[g] = out1[last] + (out1[b] - out1[last]) * w / span;
+        out2[g] = out2[last] + (out2[b] - out2[last]) * w / span;
+      }
+    }
+    last = b;
+  }
+
+  // Trailing gap (or nothing at all yet)
+  for (int g = last + 1; g < SAMPLES; g++) {
+    out1[g] = (last < 0) ? (int16_t)ADC_MID : out1[last];
+    out2[g] = (last < 0) ? (int16_t)ADC_MID : out2[last];
+  }
+  return filled;
+}
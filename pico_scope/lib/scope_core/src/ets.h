@@ -0,0 +1,39 @@
+#ifndef ETS_H
+#define ETS_H
+
+#include <stdint.h>
+
+#include "config.h"
+
+// ── Equivalent-time sampling ────────────────────────────────
+// For repetitive signals, successive triggered captures land at different
+// sub-sample phases relative to the trigger (the ADC clock is not locked to
+// the input). The trigger search already measures that phase in Q8, so
+// every capture can be binned onto a grid ETS_FACTOR times finer than the
+// ADC sample interval. After a few captures the record is filled in and
+// shows the waveform at ETS_FACTOR times the real sample rate.
+//
+// The record holds SAMPLES fine bins for both channels. Bins keep a sum and
+// a hit count; once a bin reaches ETS_BIN_MAX hits both are halved, so the
+// record follows slow changes of the input.
+
+struct EtsRecord {
+  int32_t sum1[SAMPLES];
+  int32_t sum2[SAMPLES];
+  uint16_t hits[SAMPLES];
+};
+
+void etsReset(EtsRecord &r);
+
+// Bin one capture. `trigQ8` is the trigger position in the capture buffers
+// (as returned by triggerFind), `pre` the number of fine bins before it.
+// Only the samples around the trigger that fall inside the record are read.
+void etsAdd(EtsRecord &r, const int16_t *buf1, const int16_t *buf2, int len,
+            int32_t trigQ8, int pre);
+
+// Write the record out as SAMPLES values per channel. Empty bins are
+// linearly interpolated from their filled neighbours. Returns the number of
+// filled bins.
+int etsRender(const EtsRecord &r, int16_t *out1, int16_t *out2);
+
+#endif // ETS_H
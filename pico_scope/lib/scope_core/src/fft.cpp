@@ -0,0 +1,180 @@
+#include "fft.h"
+#include "config.h"
+
+// ── constexpr tables ────────────────────────────────────────
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+
+// sin(x) for any x ≥ 0: fold into [0, π], then a Taylor series of cos
+// around π/2. Plenty accurate for Q15.
+constexpr double constSin(double x) {
+  while (x >= 2 * kPi) {
+    x -= 2 * kPi;
+  }
+  double sign = 1.0;
+  if (x > kPi) {
+    x -= kPi;
+    sign = -1.0;
+  }
+  double d = x - kPi / 2;
+  double d2 = d * d;
+  double term = 1.0;
+  double sum = 1.0;
+  for (int n = 1; n < 12; n++) {
+    term *= -d2 / ((2 * n - 1) * (2 * n));
+    sum += term;
+  }
+  return sign * sum;
+}
+
+constexpr int16_t toQ15(double v) {
+  double q = v * 32768.0;
+  q += (q >= 0) ? 0.5 : -0.5;
+  if (q > 32767.0) {
+    q = 32767.0;
+  }
+  if (q < -32768.0) {
+    q = -32768.0;
+  }
+  return (int16_t)q;
+}
+
+struct FftTables {
+  int16_t cos[FFT_N / 2]; // cos(2πk/N), Q15
+  int16_t sin[FFT_N / 2]; // sin(2πk/N), Q15
+  int16_t window[FFT_N];  // Hann, Q15
+  uint8_t bitrev[FFT_N];
+};
+
+constexpr FftTables makeTables() {
+  FftTables t{};
+  for (int k = 0; k < FFT_N / 2; k++) {
+    double a = 2 * kPi * k / FFT_N;
+    t.sin[k] = toQ15(constSin(a));
+    t.cos[k] = toQ15(constSin(a + kPi / 2));
+  }
+  for (int n = 0; n < FFT_N; n++) {
+    double s = constSin(kPi * n / FFT_N); // Hann = sin²(πn/N)
+    t.window[n] = toQ15(s * s);
+    int r = 0;
+    for (int b = 0; b < FFT_BITS; b++) {
+      r |= ((n >> b) & 1) << (FFT_BITS - 1 - b);
+    }
+    t.bitrev[n] = (uint8_t)r;
+  }
+  return t;
+}
+
+constexpr FftTables kTables = makeTables();
+
+} // namespace
+
+// ── Transform ───────────────────────────────────────────────
+void fftForward(int16_t *re, int16_t *im) {
+  for (int i = 0; i < FFT_N; i++) {
+    int j = kTables.bitrev[i];
+    if (j > i) {
+      int16_t t = re[i];
+      re[i] = re[j];
+      re[j] = t;
+      t = im[i];
+      im[i] = im[j];
+      im[j] = t;
+    }
+  }
+
+  for (int half = 1, step = FFT_N / 2; half < FFT_N; half <<= 1, step >>= 1) {
+    for (int j = 0; j < half; j++) {
+      int32_t wr = kTables.cos[j * step];
+      int32_t wi = -kTables.sin[j * step]; // forward: e^(-iθ)
+      for (int k = j; k < FFT_N; k += 2 * half) {
+        int t = k + half;
+        int32_t tr = (wr * re[t] - wi * im[t]) >> 15;
+        int32_t ti = (wr * im[t] + wi * re[t]) >> 15;
+        int32_t ur = re[k];
+        int32_t ui = im[k];
+        // Halve every stage so the result can't overflow (total 1/N)
+        re[k] = (int16_t)((ur + tr) >> 1);
+        im[k] = (int16_t)((ui + ti) >> 1);
+        re[t] = (int16_t)((ur - tr) >> 1);
+        im[t] = (int16_t)((ui - ti) >> 1);
+      }
+    }
+  }
+}
+
+int32_t fftLog2Q8(uint32_t v) {
+  int32_t msb = 31;
+  while (!(v & 0x80000000u)) {
+    v <<= 1;
+    msb--;
+  }
+  // Mantissa 1.f: log2(1 + f) ≈ f + 0.34·f·(1 − f)
+  int32_t f = (v >> 23) & 0xFF;
+  return (msb << 8) + f + ((f * (256 - f) * 87) >> 16);
+}
+
+// ── Spectrum ────────────────────────────────────────────────
+// A full-scale sine (±2048 codes → ±16384 in Q15) comes out of the
+// Hann-windowed, 1/N-scaled FFT with a bin magnitude of 16384 / 4 = 4096,
+// i.e. power 2^24. Levels are relative to that.
+#define FFT_FULL_SCALE_LOG2 24
+
+void fftSpectrum(Spectrum &s, const int16_t *samples, uint32_t intervalUs) {
+  static int16_t re[FFT_N];
+  static int16_t im[FFT_N];
+
+  int32_t sum = 0;
+  for (int i = 0; i < FFT_N; i++) {
+    sum += samples[i];
+  }
+  int32_t mean = sum / FFT_N;
+
+  for (int i = 0; i < FFT_N; i++) {
+    int32_t x = (samples[i] - mean) << 3; // 12-bit → Q15
+    re[i] = (int16_t)((x * kTables.window[i]) >> 15);
+    im[i] = 0;
+  }
+
+  fftForward(re, im);
+
+  // Log magnitude in Q8 log2 units, then dB (3.0103 dB per log2 of power).
+  // The peak search skips bins 0 and 1, where the window spreads what is
+  // left of DC.
+  int32_t logs[FFT_BINS];
+  int32_t best = 2;
+  for (int k = 0; k < FFT_BINS; k++) {
+    uint32_t p = (uint32_t)(re[k] * re[k]) + (uint32_t)(im[k] * im[k]);
+    logs[k] = (p > 0) ? fftLog2Q8(p) : 0;
+    int32_t db = (((FFT_FULL_SCALE_LOG2 << 8) - logs[k]) * 771) >> 16;
+    s.db[k] = (uint8_t)(db < 0 ? 0 : (db > 255 ? 255 : db));
+    if (k > 2 && logs[k] > logs[best]) {
+      best = k;
+    }
+  }
+
+  s.peakMilliHz = 0;
+  if (logs[best] == 0) {
+    s.peakBin = 0; // nothing but DC
+    s.peakDb = 255;
+    return;
+  }
+  s.peakBin = (uint16_t)best;
+  s.peakDb = s.db[best];
+
+  // Parabolic interpolation on the log magnitudes: offset in 1/256 bin
+  int32_t delta = 0;
+  if (best + 1 < FFT_BINS) {
+    int32_t a = logs[best - 1];
+    int32_t b = logs[best];
+    int32_t c = logs[best + 1];
+    int32_t den = a - 2 * b + c;
+    if (den != 0) {
+      delta = ((a - c) << 7) / den;
+    }
+  }
+  uint64_t fsMilliHz = 1000000000ull / intervalUs;
+  int64_t binQ8 = ((int64_t)best << 8) + delta;
+  s.peakMilliHz = (uint32_t)(binQ8 * (int64_t)fsMilliHz / (FFT_N << 8));
+}
@@ -0,0 +1,32 @@
+#ifndef FFT_H
+#define FFT_H
+
+#include <stdint.h>
+
+// ── Spectrum analyser ───────────────────────────────────────
+// Fixed-point radix-2 FFT (Q15, scaled by 1/2 per stage) on FFT_N real
+// samples with a Hann window. Twiddles, window and bit-reversal order are
+// constexpr tables, so they live in flash and cost nothing at start-up.
+
+#define FFT_BITS 8
+#define FFT_N (1 << FFT_BITS) // 256 points → 128 bins, one per column
+#define FFT_BINS (FFT_N / 2)
+
+struct Spectrum {
+  uint8_t db[FFT_BINS];  // level of each bin in dB below full scale
+  uint16_t peakBin;      // strongest bin (DC excluded), 0 if none
+  uint8_t peakDb;        // its level, dB below full scale
+  uint32_t peakMilliHz;  // interpolated peak frequency
+};
+
+// In-place forward FFT of FFT_N complex Q15 values, output scaled by 1/N.
+void fftForward(int16_t *re, int16_t *im);
+
+// Remove DC, window, transform and convert to log magnitude. 0 dB is a
+// full-scale sine (±ADC_MAX / 2 codes). intervalUs is the sample spacing.
+void fftSpectrum(Spectrum &s, const int16_t *samples, uint32_t intervalUs);
+
+// log2(v) in Q8 (v > 0).
+int32_t fftLog2Q8(uint32_t v);
+
+#endif // FFT_H
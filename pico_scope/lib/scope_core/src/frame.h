@@ -0,0 +1,97 @@
+#ifndef FRAME_H
+#define FRAME_H
+
+#include <atomic>
+#include <stdint.h>
+
+#include "config.h"
+#include "fft.h"
+#include "measure.h"
+#include "segment.h"
+#include "trigger.h"
+
+// What the render core should draw.
+enum DisplayMode : uint8_t {
+  MODE_SCOPE,   // time-domain traces
+  MODE_AVERAGE, // traces averaged over frames
+  MODE_PERSIST, // traces with decaying persistence
+  MODE_ETS,     // equivalent-time sampling of repetitive signals
+  MODE_SEGMENT, // segmented memory: bursts of trigger events
+  MODE_XY,      // CH1 against CH2
+  MODE_FFT,     // CH1 spectrum
+  MODE_COUNT
+};
+
+// One acquired frame, ready to draw: the triggered window of both channels
+// plus the settings it was captured with.
+struct Frame {
+  int16_t ch1[SAMPLES];
+  int16_t ch2[SAMPLES];
+  int16_t ch1Min[SAMPLES]; // peak-detect envelope (valid when peak is set)
+  int16_t ch1Max[SAMPLES];
+  int16_t ch2Min[SAMPLES];
+  int16_t ch2Max[SAMPLES];
+  int16_t mid1; // per-channel DC offset (mean ADC code)
+  int16_t mid2;
+  uint32_t intervalUs; // time between samples
+  float vdivScale;     // vertical zoom from the V/div pot
+  TriggerConfig trig;  // trigger settings used (level resolved)
+  bool levelAdjust;    // trigger level being set: draw it across the screen
+  bool triggered;      // false for auto-mode free-run frames
+  bool holding;        // single shot fired, waiting to be re-armed
+  bool peak;           // ch1/ch2 are column means, draw the min/max spans
+  bool rolling;        // roll mode frame (untriggered, newest on the right)
+  uint8_t firstX;      // first valid column (roll mode still filling)
+  uint8_t ets;         // equivalent-time factor: samples are intervalUs / ets
+  Measurements meas;   // of the trigger source channel
+  DisplayMode mode;
+  Spectrum spectrum;   // valid in MODE_FFT
+  SegmentInfo seg;     // valid in MODE_SEGMENT
+#if PROFILE_ENABLED
+  bool profile;        // draw the profiling overlay
+#endif
+};
+
+// Lock-free double-buffered handoff between one producer core (capture)
+// and one consumer core (render).
+//
+// The producer always owns back() and fills it. publish() hands it over if
+// the consumer has released the previous frame; otherwise the consumer is
+// still busy, the new frame is dropped and the producer refills the same
+// buffer. The consumer picks a frame up with acquire() and gives it back
+// with release() as soon as it no longer reads from it.
+class FrameExchange {
+public:
+  Frame *back() { return &frames_[backIdx_]; }
+
+  void publish() {
+    if (full_.load(std::memory_order_acquire)) {
+      dropped_.store(dropped_.load(std::memory_order_relaxed) + 1,
+                     std::memory_order_relaxed);
+      return;
+    }
+    frontIdx_ = backIdx_;
+    backIdx_ ^= 1;
+    full_.store(true, std::memory_order_release);
+  }
+
+  const Frame *acquire() {
+    if (!full_.load(std::memory_order_acquire)) {
+      return nullptr;
+    }
+    return &frames_[frontIdx_];
+  }
+
+  void release() { full_.store(false, std::memory_order_release); }
+
+  uint32_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+  Frame frames_[2];
+  uint8_t backIdx_ = 0;  // written by the producer only
+  uint8_t frontIdx_ = 1; // written by the producer before full_ is set
+  std::atomic<bool> full_{false};
+  std::atomic<uint32_t> dropped_{0};
+};
+
+#endif // FRAME_H
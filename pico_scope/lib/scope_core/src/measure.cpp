@@ -0,0 +1,98 @@
+#include "measure.h"
+#include "config.h"
+
+int32_t adcToMillivolts(int32_t codes) {
+  return codes * ADC_UV_PER_CODE / 1000;
+}
+
+static uint32_t isqrt(uint32_t v) {
+  uint32_t root = 0;
+  uint32_t bit = 1u << 30;
+  while (bit > v) {
+    bit >>= 2;
+  }
+  while (bit != 0) {
+    if (v >= root + bit) {
+      v -= root + bit;
+      root = (root >> 1) + bit;
+    } else {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+  return root;
+}
+
+void measure(Measurements &m, const int16_t *buf, int len, int16_t level,
+             int16_t hysteresis, uint32_t intervalUs) {
+  int16_t lo = buf[0];
+  int16_t hi = buf[0];
+  int32_t sum = 0;
+  uint64_t sumSq = 0;
+
+  // Rising crossings: first/last position (Q8), count, and the number of
+  // samples above the level seen at the first/last one (for duty cycle)
+  int16_t arm = level - hysteresis;
+  bool armed = false;
+  uint32_t crossings = 0;
+  int32_t firstQ8 = 0;
+  int32_t lastQ8 = 0;
+  int32_t highs = 0;
+  int32_t highsFirst = 0;
+  int32_t highsLast = 0;
+
+  for (int i = 0; i < len; i++) {
+    int16_t s = buf[i];
+    int32_t d = s - ADC_MID;
+    sum += d;
+    sumSq += (uint32_t)(d * d);
+    if (s < lo) {
+      lo = s;
+    }
+    if (s > hi) {
+      hi = s;
+    }
+
+    if (s < arm) {
+      armed = true;
+    } else if (armed && s >= level && i > 0) {
+      armed = false;
+      int32_t a = buf[i - 1];
+      int32_t pos = ((int32_t)(i - 1) << 8) + (((level - a) << 8) / (s - a));
+      if (crossings == 0) {
+        firstQ8 = pos;
+        highsFirst = highs;
+      }
+      lastQ8 = pos;
+      highsLast = highs;
+      crossings++;
+    }
+    if (s >= level) {
+      highs++;
+    }
+  }
+
+  m.vppMv = adcToMillivolts(hi - lo);
+  m.meanMv = adcToMillivolts(sum / len);
+  // Mean square has 8 fractional bits before the root → RMS in 1/16 codes
+  uint32_t meanSq = (uint32_t)(sumSq / (uint32_t)len);
+  m.rmsMv = (int32_t)isqrt(meanSq << 8) * ADC_UV_PER_CODE / 16000;
+
+  m.periodNs = 0;
+  m.freqMilliHz = 0;
+  m.dutyPermille = 0;
+  if (crossings < 2 || lastQ8 <= firstQ8) {
+    return;
+  }
+
+  uint64_t spanQ8 = (uint64_t)(lastQ8 - firstQ8);
+  uint64_t spanNs = spanQ8 * intervalUs * 1000 / 256;
+  m.periodNs = (uint32_t)(spanNs / (crossings - 1));
+  if (m.periodNs > 0) {
+    m.freqMilliHz = (uint32_t)(1000000000000ull / m.periodNs);
+  }
+  int32_t spanSamples = (lastQ8 >> 8) - (firstQ8 >> 8);
+  if (spanSamples > 0) {
+    m.dutyPermille = (uint16_t)((highsLast - highsFirst) * 1000 / spanSamples);
+  }
+}
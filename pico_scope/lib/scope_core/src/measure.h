@@ -0,0 +1,31 @@
+#ifndef MEASURE_H
+#define MEASURE_H
+
+#include <stdint.h>
+
+// ── Automatic measurements ──────────────────────────────────
+// Frequency/period from rising crossings of the trigger level, plus Vpp,
+// mean, RMS and duty cycle. Everything comes out of a single pass over the
+// capture buffer with integer accumulators.
+//
+// Volts use the same calibration as the display: ADC_MID is 0 V and half
+// the ADC range spans BASE_VPP_AT_VSCALE_1 / 2 (see ADC_UV_PER_CODE).
+
+struct Measurements {
+  int32_t vppMv;
+  int32_t meanMv;
+  int32_t rmsMv;         // true RMS around 0 V
+  uint32_t periodNs;     // 0 if fewer than two crossings were found
+  uint32_t freqMilliHz;  // 0 if no period
+  uint16_t dutyPermille; // time above the level per period, 0–1000
+};
+
+// Measure buf[0..len) sampled every intervalUs. Crossings use the same
+// level/hysteresis rule as the trigger (rising edge).
+void measure(Measurements &m, const int16_t *buf, int len, int16_t level,
+             int16_t hysteresis, uint32_t intervalUs);
+
+// ADC codes (relative to ADC_MID for absolute values) → millivolts.
+int32_t adcToMillivolts(int32_t codes);
+
+#endif // MEASURE_H
@@ -0,0 +1,135 @@
+#include "peak.h"
+#include "capture.h"
+#include "config.h"
+
+static void startColumn(PeakReducer &r) {
+  r.n = 0;
+  r.lo = ADC_MAX;
+  r.hi = 0;
+  r.sum = 0;
+}
+
+void peakBegin(PeakReducer &r, int16_t *mins, int16_t *maxs, int16_t *means,
+               uint32_t columns, uint32_t perColumn, bool wrap) {
+  r.mins = mins;
+  r.maxs = maxs;
+  r.means = means;
+  r.columns = columns;
+  r.perColumn = perColumn ? perColumn : 1;
+  r.wrap = wrap;
+  r.column = 0;
+  r.done = 0;
+  startColumn(r);
+}
+
+static void finishColumn(PeakReducer &r) {
+  // The input stage is inverting: raw max is the displayed min
+  r.mins[r.column] = ADC_MAX - (int16_t)r.hi;
+  r.maxs[r.column] = ADC_MAX - (int16_t)r.lo;
+  if (r.means) {
+    r.means[r.column] = ADC_MAX - (int16_t)(r.sum / r.n);
+  }
+  r.done++;
+  r.column++;
+  if (r.wrap && r.column >= r.columns) {
+    r.column = 0;
+  }
+  startColumn(r);
+}
+
+bool peakFeed(PeakReducer &r, const volatile uint16_t *raw, uint32_t count,
+              uint32_t stride) {
+  while (count > 0 && r.column < r.columns) {
+    // Run the inner loop over as much of the current column as we have
+    uint32_t take = (r.n < r.perColumn) ? r.perColumn - r.n : 0;
+    if (take > count) {
+      take = count;
+    }
+    uint16_t lo = r.lo;
+    uint16_t hi = r.hi;
+    uint32_t sum = r.sum;
+    for (uint32_t i = 0; i < take; i++) {
+      uint16_t s = raw[i * stride];
+      if (s < lo) {
+        lo = s;
+      }
+      if (s > hi) {
+        hi = s;
+      }
+      sum += s;
+    }
+    r.lo = lo;
+    r.hi = hi;
+    r.sum = sum;
+    r.n += take;
+    raw += take * stride;
+    count -= take;
+
+    if (r.n >= r.perColumn) {
+      finishColumn(r);
+    }
+  }
+  return r.column >= r.columns;
+}
+
+uint32_t peakStream(PeakReducer &r, uint32_t from, uint32_t count) {
+  const volatile uint16_t *ring = captureRing();
+  uint32_t tail = from;
+
+  while (count > 0 && r.column < r.columns) {
+    uint32_t head = captureHead();
+    uint32_t avail = (head - tail) & CAPTURE_RING_MASK;
+    if (avail > count) {
+      avail = count;
+    }
+    count -= avail;
+
+    // Feed up to the ring end first if the new samples wrap around
+    uint32_t first = CAPTURE_RING_LEN - tail;
+    if (avail > first) {
+      peakFeed(r, ring + tail, first);
+      peakFeed(r, ring, avail - first);
+    } else {
+      peakFeed(r, ring + tail, avail);
+    }
+    tail = (tail + avail) & CAPTURE_RING_MASK;
+  }
+  return tail;
+}
+
+uint32_t peakCapture(PeakReducer &r, uint32_t from) {
+  return peakStream(r, from, 0xFFFFFFFFu);
+}
+
+uint32_t peakStreamDual(PeakReducer &r1, PeakReducer &r2, uint32_t from,
+                        uint32_t count) {
+  const volatile uint16_t *ring = captureRing();
+  uint32_t tail = from & ~1u;
+
+  while (count > 0 && r1.column < r1.columns) {
+    uint32_t head = captureHead() & ~1u; // whole pairs only
+    uint32_t avail = ((head - tail) & CAPTURE_RING_MASK) / 2;
+    if (avail > count) {
+      avail = count;
+    }
+    count -= avail;
+
+    // The ring length is even, so a pair never straddles the wrap
+    uint32_t first = (CAPTURE_RING_LEN - tail) / 2;
+    if (avail > first) {
+      peakFeed(r1, ring + tail, first, 2);
+      peakFeed(r2, ring + tail + 1, first, 2);
+      peakFeed(r1, ring, avail - first, 2);
+      peakFeed(r2, ring + 1, avail - first, 2);
+    } else {
+      peakFeed(r1, ring + tail, avail, 2);
+      peakFeed(r2, ring + tail + 1, avail, 2);
+    }
+    tail = (tail + 2 * avail) & CAPTURE_RING_MASK;
+  }
+  return tail;
+}
+
+uint32_t peakCaptureDual(PeakReducer &r1, PeakReducer &r2, uint32_t from) {
+  return peakStreamDual(r1, r2, from, 0xFFFFFFFFu);
+}
@@ -0,0 +1,55 @@
+#ifndef PEAK_H
+#define PEAK_H
+
+#include <stdint.h>
+
+// ── Peak-detect decimation ──────────────────────────────────
+// At slow time bases the ADC still runs at full speed and every displayed
+// column is reduced to the min, max (and optionally mean) of all the raw
+// samples it covers, so short pulses and audio-rate content stay visible.
+//
+// The reducer is streaming and allocation-free: samples are consumed
+// straight from the DMA ring as they arrive and only the running column
+// state is kept.
+
+struct PeakReducer {
+  int16_t *mins;  // per-column minimum (inverted ADC codes, like captureCopy)
+  int16_t *maxs;  // per-column maximum
+  int16_t *means; // per-column mean, may be nullptr
+  uint32_t columns;
+  uint32_t perColumn; // raw samples per column (may change while running)
+  bool wrap;          // circular: start over at column 0 instead of stopping
+
+  uint32_t column; // column being filled
+  uint32_t done;   // columns completed so far
+  uint32_t n;      // raw samples in the current column
+  uint16_t lo;     // running raw min / max / sum of the current column
+  uint16_t hi;
+  uint32_t sum;
+};
+
+void peakBegin(PeakReducer &r, int16_t *mins, int16_t *maxs, int16_t *means,
+               uint32_t columns, uint32_t perColumn, bool wrap = false);
+
+// Consume raw samples, `stride` slots apart (2 for one channel of an
+// interleaved pair stream); returns true once every column is complete
+// (extra samples are ignored). A wrapping reducer never completes.
+bool peakFeed(PeakReducer &r, const volatile uint16_t *raw, uint32_t count,
+              uint32_t stride = 1);
+
+// Stream samples from the capture ring, starting at ring index `from`, into
+// the reducer until it is complete. Returns the ring index reached.
+uint32_t peakCapture(PeakReducer &r, uint32_t from);
+
+// Same, but stop after `count` raw samples (or on completion).
+uint32_t peakStream(PeakReducer &r, uint32_t from, uint32_t count);
+
+// Dual-channel versions for a captureStartDual() ring: CH1 pairs go to r1,
+// CH2 to r2 (both set up with the same column layout). `from` must be even;
+// `count` is in pairs. At peak-detect rates the one-conversion skew is a
+// tiny fraction of a column and is not corrected.
+uint32_t peakStreamDual(PeakReducer &r1, PeakReducer &r2, uint32_t from,
+                        uint32_t count);
+uint32_t peakCaptureDual(PeakReducer &r1, PeakReducer &r2, uint32_t from);
+
+#endif // PEAK_H
@@ -0,0 +1,39 @@
+#include "persist.h"
+
+#include <string.h>
+
+// 4×4 Bayer matrix scaled to 0..255 thresholds
+static const uint8_t bayer[4][4] = {
+    {8, 136, 40, 168},
+    {200, 72, 232, 104},
+    {56, 184, 24, 152},
+    {248, 120, 216, 88},
+};
+
+void persistClear(Persistence &p) { memset(p.level, 0, sizeof(p.level)); }
+
+void persistApply(Persistence &p, uint8_t *buf) {
+  for (int row = 0; row < WAVEFORM_H; row++) {
+    int y = WAVEFORM_TOP + row;
+    uint8_t *col = buf + (y >> 3) * SCREEN_W;
+    const uint8_t mask = 1u << (y & 7);
+    const uint8_t *threshold = bayer[y & 3];
+    uint8_t *level = p.level[row];
+
+    for (int x = 0; x < SCREEN_W; x++) {
+      uint8_t v;
+      if (col[x] & mask) {
+        v = 255;
+      } else {
+        v = (uint8_t)((level[x] * PERSIST_DECAY) >> 8);
+      }
+      level[x] = v;
+
+      if (v > threshold[x & 3]) {
+        col[x] |= mask;
+      } else {
+        col[x] &= ~mask;
+      }
+    }
+  }
+}
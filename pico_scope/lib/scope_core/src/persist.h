@@ -0,0 +1,25 @@
+#ifndef PERSIST_H
+#define PERSIST_H
+
+#include <stdint.h>
+
+#include "config.h"
+
+// ── Digital persistence ─────────────────────────────────────
+// Every pixel of the waveform area has an 8-bit intensity. Pixels drawn in
+// the current frame are set to full intensity, all others decay by
+// PERSIST_DECAY / 256 per frame. The SH1106 is 1-bit, so the intensities
+// are written back with a 4×4 ordered dither: fading traces turn into
+// progressively sparser dot patterns that stay put from frame to frame.
+
+struct Persistence {
+  uint8_t level[WAVEFORM_H][SCREEN_W];
+};
+
+void persistClear(Persistence &p);
+
+// Fold the pixels set in the waveform area of the U8g2 page buffer into the
+// intensities, decay the rest and write the dithered image back.
+void persistApply(Persistence &p, uint8_t *buf);
+
+#endif // PERSIST_H
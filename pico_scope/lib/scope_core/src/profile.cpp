@@ -0,0 +1,72 @@
+#include "profile.h"
+
+#if PROFILE_ENABLED
+
+#if defined(ARDUINO)
+#include <Arduino.h>
+#else
+#include <chrono>
+#endif
+
+static uint32_t samples[PROF_STAGES][PROFILE_FRAMES];
+static uint32_t written[PROF_STAGES];
+
+uint32_t profileNow() {
+#if defined(ARDUINO)
+  return micros();
+#else
+  using namespace std::chrono;
+  return (uint32_t)duration_cast<microseconds>(
+             steady_clock::now().time_since_epoch())
+      .count();
+#endif
+}
+
+void profileRecord(ProfileStage stage, uint32_t us) {
+  uint32_t n = written[stage];
+  samples[stage][n % PROFILE_FRAMES] = us;
+  written[stage] = n + 1;
+}
+
+void profileStats(ProfileStage stage, ProfileStats &s) {
+  uint32_t n = written[stage];
+  if (n > PROFILE_FRAMES) {
+    n = PROFILE_FRAMES;
+  }
+  s.frames = n;
+  s.minUs = 0;
+  s.avgUs = 0;
+  s.maxUs = 0;
+  if (n == 0) {
+    return;
+  }
+
+  // The other core may be writing a slot meanwhile; a stale value only
+  // shifts the stats by one frame.
+  uint32_t lo = 0xFFFFFFFFu;
+  uint32_t hi = 0;
+  uint64_t sum = 0;
+  for (uint32_t i = 0; i < n; i++) {
+    uint32_t v = samples[stage][i];
+    lo = (v < lo) ? v : lo;
+    hi = (v > hi) ? v : hi;
+    sum += v;
+  }
+  s.minUs = lo;
+  s.avgUs = (uint32_t)(sum / n);
+  s.maxUs = hi;
+}
+
+void profileReset() {
+  for (int i = 0; i < PROF_STAGES; i++) {
+    written[i] = 0;
+  }
+}
+
+const char *profileName(ProfileStage stage) {
+  static const char *const names[PROF_STAGES] = {
+      "pots", "capt", "trig", "offs", "fft", "draw", "send"};
+  return (stage < PROF_STAGES) ? names[stage] : "?";
+}
+
+#endif // PROFILE_ENABLED
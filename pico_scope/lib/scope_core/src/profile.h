@@ -0,0 +1,57 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <stdint.h>
+
+#include "config.h"
+
+// ── Frame pipeline profiling ────────────────────────────────
+// Wall-clock time of each pipeline stage, kept for the last PROFILE_FRAMES
+// frames in a per-stage ring so min/avg/max can be shown on screen or
+// dumped over serial. Each stage is only ever timed from one core, so the
+// rings need no locking.
+//
+// Wrap the stages in PROFILE_BEGIN / PROFILE_END. With PROFILE_ENABLED set
+// to 0 (config.h) the macros expand to nothing and no timer is read.
+
+enum ProfileStage : uint8_t {
+  PROF_POTS,    // core1: pot reads
+  PROF_CAPTURE, // core1: ADC/DMA capture (and copy out of the ring)
+  PROF_TRIGGER, // core1: trigger search and window copy
+  PROF_OFFSETS, // core1: DC offset computation
+  PROF_FFT,     // core1: spectrum of FFT mode (window, FFT, log magnitude)
+  PROF_DRAW,    // core0: drawing into the display buffer
+  PROF_SEND,    // core0: display transfer
+  PROF_STAGES
+};
+
+struct ProfileStats {
+  uint32_t minUs;
+  uint32_t avgUs;
+  uint32_t maxUs;
+  uint32_t frames; // samples the stats are based on
+};
+
+#if PROFILE_ENABLED
+#define PROFILE_BEGIN(stage) const uint32_t profileStart_##stage = profileNow()
+#define PROFILE_END(stage) \
+  profileRecord(stage, profileNow() - profileStart_##stage)
+#else
+#define PROFILE_BEGIN(stage)
+#define PROFILE_END(stage)
+#endif
+
+// Microsecond timer (micros() on the Pico, a steady clock on the host).
+uint32_t profileNow();
+
+void profileRecord(ProfileStage stage, uint32_t us);
+
+void profileStats(ProfileStage stage, ProfileStats &s);
+
+// Forget all recorded frames (host benchmark, between scenarios).
+void profileReset();
+
+// Short stage label for the overlay and the serial dump ("capt").
+const char *profileName(ProfileStage stage);
+
+#endif // PROFILE_H
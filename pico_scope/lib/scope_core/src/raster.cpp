@@ -0,0 +1,85 @@
+#include "raster.h"
+#include "config.h"
+
+void rasterPixel(uint8_t *buf, int x, int y) {
+  if (y < 0 || y >= SCREEN_H) {
+    return;
+  }
+  buf[(y >> 3) * SCREEN_W + x] |= (uint8_t)(1 << (y & 7));
+}
+
+void rasterVSpan(uint8_t *buf, int x, int y0, int y1) {
+  if (y0 > y1) {
+    int t = y0;
+    y0 = y1;
+    y1 = t;
+  }
+  if (y0 < 0) {
+    y0 = 0;
+  }
+  if (y1 >= SCREEN_H) {
+    y1 = SCREEN_H - 1;
+  }
+  if (y0 > y1) {
+    return;
+  }
+
+  uint8_t *col = buf + x;
+  int p0 = y0 >> 3;
+  int p1 = y1 >> 3;
+  uint8_t top = (uint8_t)(0xFF << (y0 & 7));
+  uint8_t bottom = (uint8_t)(0xFF >> (7 - (y1 & 7)));
+
+  if (p0 == p1) {
+    col[p0 * SCREEN_W] |= top & bottom;
+    return;
+  }
+  col[p0 * SCREEN_W] |= top;
+  for (int p = p0 + 1; p < p1; p++) {
+    col[p * SCREEN_W] = 0xFF;
+  }
+  col[p1 * SCREEN_W] |= bottom;
+}
+
+void rasterHDots(uint8_t *buf, int y, int step) {
+  if (y < 0 || y >= SCREEN_H) {
+    return;
+  }
+  uint8_t *row = buf + (y >> 3) * SCREEN_W;
+  uint8_t mask = (uint8_t)(1 << (y & 7));
+  for (int x = 0; x < SCREEN_W; x += step) {
+    row[x] |= mask;
+  }
+}
+
+// One segment from (x, ya) to (x + 1, yb), pixel-exact with U8g2's
+// Bresenham drawLine(): for steep segments the starting column gets the
+// first (dy / 2 + 1) rows and the other column the rest.
+static inline void segment(uint8_t *buf, int x, int ya, int yb) {
+  int dy = yb - ya;
+  if (dy >= -1 && dy <= 1) {
+    rasterPixel(buf, x, ya);
+    rasterPixel(buf, x + 1, yb);
+  } else if (dy > 0) {
+    int h = dy >> 1;
+    rasterVSpan(buf, x, ya, ya + h);
+    rasterVSpan(buf, x + 1, ya + h + 1, yb);
+  } else {
+    // Rising segment: U8g2 swaps the endpoints and starts from (x + 1, yb)
+    int h = (-dy) >> 1;
+    rasterVSpan(buf, x + 1, yb, yb + h);
+    rasterVSpan(buf, x, yb + h + 1, ya);
+  }
+}
+
+void rasterSolid(uint8_t *buf, const uint8_t *ys, int count) {
+  for (int x = 0; x < count - 1; x++) {
+    segment(buf, x, ys[x], ys[x + 1]);
+  }
+}
+
+void rasterDotted(uint8_t *buf, const uint8_t *ys, int count, int step) {
+  for (int x = 0; x < count - 1; x += step) {
+    rasterPixel(buf, x, ys[x]);
+  }
+}
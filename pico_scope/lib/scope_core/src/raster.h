@@ -0,0 +1,31 @@
+#ifndef RASTER_H
+#define RASTER_H
+
+#include <stdint.h>
+
+// ── Column rasterizer ───────────────────────────────────────
+// Draws straight into U8g2's full-frame buffer for the SH1106: 8 pages of
+// SCREEN_W bytes, one byte per column per page, LSB = top row of the page.
+// Traces are one pixel wide, so everything is written as vertical spans
+// with bitmasks instead of going through U8g2's generic pixel/line paths.
+// Output is pixel-for-pixel what U8g2 draws for the same calls.
+//
+// All Y coordinates are clipped to the screen; X must be on screen.
+
+// Set one pixel (drawPixel).
+void rasterPixel(uint8_t *buf, int x, int y);
+
+// Vertical span from y0 to y1 inclusive, either order (drawVLine).
+void rasterVSpan(uint8_t *buf, int x, int y0, int y1);
+
+// Horizontal dotted line: a pixel every `step` columns from x = 0.
+void rasterHDots(uint8_t *buf, int y, int step);
+
+// Solid trace: ys[x] joined by drawLine(x, ys[x], x + 1, ys[x + 1]).
+void rasterSolid(uint8_t *buf, const uint8_t *ys, int count);
+
+// Dotted trace: a pixel at ys[x] for every `step`-th x < count - 1 (the
+// CH2 style of the original renderer).
+void rasterDotted(uint8_t *buf, const uint8_t *ys, int count, int step);
+
+#endif // RASTER_H
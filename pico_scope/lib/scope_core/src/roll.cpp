@@ -0,0 +1,35 @@
+#include "roll.h"
+
+void rollBegin(RollBuffer &roll, uint32_t perColumn) {
+  peakBegin(roll.reducer, roll.mins, roll.maxs, roll.means, SAMPLES,
+            perColumn, true);
+}
+
+void rollSetRate(RollBuffer &roll, uint32_t perColumn) {
+  roll.reducer.perColumn = perColumn ? perColumn : 1;
+}
+
+int rollCopy(const RollBuffer &roll, int16_t *mins, int16_t *maxs,
+             int16_t *means) {
+  uint32_t filled = roll.reducer.done;
+  if (filled > SAMPLES) {
+    filled = SAMPLES;
+  }
+  int first = SAMPLES - filled;
+
+  // Oldest column: the one about to be overwritten, or 0 while filling
+  uint32_t src = (filled < SAMPLES) ? 0 : roll.reducer.column;
+  for (int x = first; x < SAMPLES; x++) {
+    mins[x] = roll.mins[src];
+    maxs[x] = roll.maxs[src];
+    means[x] = roll.means[src];
+    if (++src >= SAMPLES) {
+      src = 0;
+    }
+  }
+  int16_t fill = (first < SAMPLES) ? means[first] : (int16_t)ADC_MID;
+  for (int x = 0; x < first; x++) {
+    mins[x] = maxs[x] = means[x] = fill;
+  }
+  return first;
+}
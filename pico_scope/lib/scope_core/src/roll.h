@@ -0,0 +1,33 @@
+#ifndef ROLL_H
+#define ROLL_H
+
+#include <stdint.h>
+
+#include "config.h"
+#include "peak.h"
+
+// ── Roll mode ───────────────────────────────────────────────
+// Untriggered display for slow time bases. The ADC streams continuously
+// into a wrapping peak reducer, one column per sample interval, and every
+// frame shows the newest SAMPLES columns with the latest on the right. The
+// screen updates at the frame rate no matter how slow the time base is.
+
+struct RollBuffer {
+  int16_t mins[SAMPLES]; // circular, oldest column at reducer.column
+  int16_t maxs[SAMPLES];
+  int16_t means[SAMPLES];
+  PeakReducer reducer;
+};
+
+// Clear the buffer and start a new roll at `perColumn` raw samples/column.
+void rollBegin(RollBuffer &roll, uint32_t perColumn);
+
+// Change the column rate without clearing what is already on screen.
+void rollSetRate(RollBuffer &roll, uint32_t perColumn);
+
+// Unroll into linear arrays, oldest first. While the roll is still filling
+// the data is right-aligned; returns the first valid column.
+int rollCopy(const RollBuffer &roll, int16_t *mins, int16_t *maxs,
+             int16_t *means);
+
+#endif // ROLL_H
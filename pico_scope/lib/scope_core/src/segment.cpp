@@ -0,0 +1,132 @@
+#include "segment.h"
+
+// Pairs of the interleaved stream are counted from the start of the burst;
+// the ring restarts at index 0, so pair n sits at ring index 2n (mod size).
+static uint32_t ringIndex(uint32_t pair) {
+  return (2 * pair) & CAPTURE_RING_MASK;
+}
+
+// Number of complete pairs written so far, advanced from `written`. Exact
+// as long as we poll at least once per ring period.
+static uint32_t pairsWritten(uint32_t written) {
+  uint32_t head = captureHead() & ~1u;
+  return written + ((head - ringIndex(written)) & CAPTURE_RING_MASK) / 2;
+}
+
+// Copy the segment around the crossing at Q8 pair position `trigQ8`:
+// SAMPLES + 1 pairs ending SAMPLES - SEG_PRE pairs after it, then shift by
+// the sub-sample part so every segment is aligned to the crossing.
+static void copySegment(Segment &s, int32_t trigQ8) {
+  static int16_t tmp1[SAMPLES + 1];
+  static int16_t tmp2[SAMPLES + 1];
+
+  uint32_t first = (uint32_t)(trigQ8 >> 8) - SEG_PRE;
+  uint32_t end = first + SAMPLES + 1;
+  captureCopyDual(tmp1, tmp2, ringIndex(end), SAMPLES + 1, 1);
+  triggerWindow(s.ch1, tmp1, trigQ8 & 0xFF, SAMPLES);
+  triggerWindow(s.ch2, tmp2, trigQ8 & 0xFF, SAMPLES);
+}
+
+uint8_t segmentCapture(SegmentMemory &m, const TriggerConfig &cfg,
+                       const CaptureTiming &timing, uint32_t timeoutPairs,
+                       bool (*cancel)()) {
+  const volatile uint16_t *ring = captureRing();
+  const uint32_t post = SAMPLES - SEG_PRE;
+
+  // Falling edges run the rising-edge search on the mirrored signal
+  const int32_t sign = (cfg.slope == TRIG_RISING) ? 1 : -1;
+  const int32_t level = sign * cfg.level;
+  const int32_t arm = level - cfg.hysteresis;
+
+  m.count = 0;
+  m.deadUs = 0;
+
+  captureStartDual(PIN_CH1, PIN_CH2, timing);
+
+  uint32_t written = 0;
+  uint32_t n = SEG_PRE + 1; // next pair to search; keeps room for history
+  uint32_t lastEvent = n;   // start of the burst, then each segment's end
+  uint32_t firstTrig = 0;
+  bool armed = false;
+  int32_t prev = 0;
+
+  while (m.count < SEG_COUNT && n - lastEvent < timeoutPairs) {
+    if (n >= written) {
+      if (cancel != nullptr && cancel()) {
+        break; // keep the segments stored so far
+      }
+      written = pairsWritten(written);
+      continue;
+    }
+
+    int32_t v = sign * (ADC_MAX - (int32_t)ring[ringIndex(n) + cfg.source]);
+    if (!armed) {
+      if (v < arm) {
+        armed = true;
+        // Time from the end of the last segment until a trigger could be
+        // recognised again
+        if (m.count > 0) {
+          uint32_t dead = (n - lastEvent) * timing.intervalUs;
+          if (dead > m.deadUs) {
+            m.deadUs = dead;
+          }
+        }
+      }
+    } else if (v >= level) {
+      int32_t frac = ((level - prev) << 8) / (v - prev); // 1..256
+      int32_t trigQ8 = ((int32_t)(n - 1) << 8) + frac;
+
+      // Wait for the post-trigger part, then copy it while DMA carries on
+      while (written < n + post + 1) {
+        written = pairsWritten(written);
+      }
+      Segment &s = m.seg[m.count];
+      copySegment(s, trigQ8);
+      if (m.count == 0) {
+        firstTrig = n;
+      }
+      s.timeUs = (n - firstTrig) * timing.intervalUs;
+      m.count++;
+
+      // Resume after the segment; the trigger has to re-arm first
+      n += post;
+      lastEvent = n;
+      armed = false;
+    }
+    prev = v;
+    n++;
+  }
+
+  captureStop();
+  return m.count;
+}
+
+void segmentOverlay(const SegmentMemory &m, int16_t *mean1, int16_t *min1,
+                    int16_t *max1, int16_t *mean2, int16_t *min2,
+                    int16_t *max2) {
+  for (int x = 0; x < SAMPLES; x++) {
+    int32_t sum1 = 0;
+    int32_t sum2 = 0;
+    int16_t lo1 = ADC_MAX;
+    int16_t hi1 = 0;
+    int16_t lo2 = ADC_MAX;
+    int16_t hi2 = 0;
+    for (int i = 0; i < m.count; i++) {
+      int16_t a = m.seg[i].ch1[x];
+      int16_t b = m.seg[i].ch2[x];
+      sum1 += a;
+      sum2 += b;
+      lo1 = (a < lo1) ? a : lo1;
+      hi1 = (a > hi1) ? a : hi1;
+      lo2 = (b < lo2) ? b : lo2;
+      hi2 = (b > hi2) ? b : hi2;
+    }
+    int n = m.count ? m.count : 1;
+    mean1[x] = (int16_t)(sum1 / n);
+    mean2[x] = (int16_t)(sum2 / n);
+    min1[x] = lo1;
+    max1[x] = hi1;
+    min2[x] = lo2;
+    max2[x] = hi2;
+  }
+}
@@ -0,0 +1,57 @@
+#ifndef SEGMENT_H
+#define SEGMENT_H
+
+#include <stdint.h>
+
+#include "capture.h"
+#include "config.h"
+#include "trigger.h"
+
+// ── Segmented memory ────────────────────────────────────────
+// Captures a burst of trigger events back to back: every trigger stores a
+// short segment of both channels (SEG_PRE samples before the trigger, the
+// rest after) with its time stamp, until SEG_COUNT segments are stored or
+// the input goes quiet for a while.
+//
+// The ADC and DMA never stop during a burst. The trigger is searched on
+// the ring as samples arrive, and the search resumes right after the end
+// of each segment, so nothing is missed while a segment is copied out. The
+// only dead time left is the trigger's own re-arm (the signal has to move
+// back past the hysteresis band), which is measured per segment.
+
+struct Segment {
+  int16_t ch1[SAMPLES];
+  int16_t ch2[SAMPLES];
+  uint32_t timeUs; // trigger time after the first segment's trigger
+};
+
+struct SegmentMemory {
+  Segment seg[SEG_COUNT];
+  uint8_t count;   // segments stored by the last burst
+  uint32_t deadUs; // longest re-arm dead time between segments
+};
+
+// What a frame shows of the memory.
+struct SegmentInfo {
+  uint8_t index;   // 0 = all segments overlaid, else segment number
+  uint8_t count;   // segments in memory
+  uint32_t timeUs; // shown segment's time stamp (last one when overlaid)
+  uint32_t deadUs; // longest re-arm dead time
+};
+
+// Capture one burst with both channels at `timing` (no oversampling) and a
+// resolved trigger config. Gives up after `timeoutPairs` samples without a
+// trigger, or as soon as `cancel` returns true: it is called (if given)
+// whenever the search waits for the ADC, so a caller can keep its buttons
+// running during a long burst. Returns the number of segments stored.
+uint8_t segmentCapture(SegmentMemory &m, const TriggerConfig &cfg,
+                       const CaptureTiming &timing, uint32_t timeoutPairs,
+                       bool (*cancel)() = nullptr);
+
+// Overlay all stored segments as per-column mean/min/max envelopes (the
+// peak-detect layout), so core0 draws them like a peak-detect frame.
+void segmentOverlay(const SegmentMemory &m, int16_t *mean1, int16_t *min1,
+                    int16_t *max1, int16_t *mean2, int16_t *min2,
+                    int16_t *max2);
+
+#endif // SEGMENT_H
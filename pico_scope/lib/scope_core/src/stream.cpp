@@ -0,0 +1,48 @@
+#include "stream.h"
+
+static_assert(sizeof(StreamHeader) == 24, "stream header is 24 bytes");
+
+void streamHeader(StreamHeader &h, uint32_t seq, uint32_t timeUs,
+                  uint32_t intervalNs, uint16_t count, uint8_t channels,
+                  uint16_t trigIndex) {
+  for (int i = 0; i < 4; i++) {
+    h.magic[i] = STREAM_MAGIC[i];
+  }
+  h.version = STREAM_VERSION;
+  h.channels = channels;
+  h.count = count;
+  h.seq = seq;
+  h.timeUs = timeUs;
+  h.intervalNs = intervalNs;
+  h.trigIndex = trigIndex;
+  h.reserved = 0;
+}
+
+void streamChecksumBegin(StreamChecksum &c) {
+  c.a = 0;
+  c.b = 0;
+}
+
+void streamChecksumAdd(StreamChecksum &c, const volatile void *data,
+                       uint32_t len) {
+  const volatile uint8_t *p = (const volatile uint8_t *)data;
+  uint32_t a = c.a;
+  uint32_t b = c.b;
+  while (len > 0) {
+    // Both sums stay below 2^32 for 5802 bytes between reductions
+    uint32_t n = (len > 5802) ? 5802 : len;
+    len -= n;
+    while (n-- > 0) {
+      a += *p++;
+      b += a;
+    }
+    a %= 255;
+    b %= 255;
+  }
+  c.a = (uint16_t)a;
+  c.b = (uint16_t)b;
+}
+
+uint16_t streamChecksumValue(const StreamChecksum &c) {
+  return (uint16_t)(c.b << 8 | c.a);
+}
@@ -0,0 +1,52 @@
+#ifndef STREAM_H
+#define STREAM_H
+
+#include <stdint.h>
+
+// ── Waveform streaming protocol ─────────────────────────────
+// Raw captures are sent over USB serial as self-delimiting binary frames:
+//
+//   StreamHeader (24 bytes, little-endian)
+//   payload: count * channels raw ADC words (uint16, 12-bit, interleaved
+//            CH1, CH2, ... exactly as the DMA wrote them; the input stage is
+//            inverting, so 0 V is ADC_MID and higher codes are lower volts.
+//            Channels are converted in turn, so CH2 lags CH1 by
+//            intervalNs / channels)
+//   checksum: Fletcher-16 of header + payload (uint16)
+//
+// The payload goes out straight from the DMA ring, without copying or
+// repacking. The reader finds frames by the magic and drops any frame
+// whose checksum doesn't match, so it can join a stream at any point.
+
+#define STREAM_MAGIC "PSCP"
+#define STREAM_VERSION 1
+#define STREAM_NO_TRIGGER 0xFFFF
+
+struct StreamHeader {
+  char magic[4];       // STREAM_MAGIC
+  uint8_t version;     // STREAM_VERSION
+  uint8_t channels;    // interleaved channels in the payload
+  uint16_t count;      // samples per channel
+  uint32_t seq;        // frame number, gaps mean skipped frames
+  uint32_t timeUs;     // capture end, microseconds since boot (wraps)
+  uint32_t intervalNs; // time between samples of one channel
+  uint16_t trigIndex;  // sample of the trigger crossing, or STREAM_NO_TRIGGER
+  uint16_t reserved;
+};
+
+// Running Fletcher-16 sums.
+struct StreamChecksum {
+  uint16_t a;
+  uint16_t b;
+};
+
+void streamHeader(StreamHeader &h, uint32_t seq, uint32_t timeUs,
+                  uint32_t intervalNs, uint16_t count, uint8_t channels,
+                  uint16_t trigIndex);
+
+void streamChecksumBegin(StreamChecksum &c);
+void streamChecksumAdd(StreamChecksum &c, const volatile void *data,
+                       uint32_t len);
+uint16_t streamChecksumValue(const StreamChecksum &c);
+
+#endif // STREAM_H
@@ -0,0 +1,123 @@
+#include "trigger.h"
+#include "config.h"
+
+TriggerConfig triggerDefaults() {
+  TriggerConfig cfg;
+  cfg.level = TRIG_DEFAULT_LEVEL;
+  cfg.hysteresis = TRIG_DEFAULT_HYST;
+  cfg.slope = TRIG_RISING;
+  cfg.source = 0;
+  cfg.mode = TRIG_AUTO;
+  cfg.preTrigger = TRIG_DEFAULT_PRETRIG;
+  cfg.interpolate = true;
+  return cfg;
+}
+
+TriggerConfig triggerResolve(const TriggerConfig &cfg, const int16_t *buf,
+                             int len) {
+  TriggerConfig out = cfg;
+  int16_t lo = buf[0];
+  int16_t hi = buf[0];
+  for (int i = 1; i < len; i++) {
+    if (buf[i] < lo) {
+      lo = buf[i];
+    }
+    if (buf[i] > hi) {
+      hi = buf[i];
+    }
+  }
+
+  if (cfg.level == TRIG_LEVEL_AUTO) {
+    out.level = (int16_t)((lo + hi) / 2);
+  }
+  int16_t hyst = (int16_t)((hi - lo) >> TRIG_AUTO_HYST_SHIFT);
+  if (hyst > out.hysteresis) {
+    out.hysteresis = hyst;
+  }
+  return out;
+}
+
+// Crossing between a (below) and b (at or above) the level, in Q8.
+static int32_t crossing(int i, int32_t a, int32_t b, int32_t level,
+                        bool interpolate) {
+  if (!interpolate) {
+    return (int32_t)i << 8;
+  }
+  int32_t frac = ((level - a) << 8) / (b - a); // 1..256
+  return ((int32_t)(i - 1) << 8) + frac;
+}
+
+int32_t triggerFind(const int16_t *buf, int from, int to,
+                    const TriggerConfig &cfg) {
+  int i = (from < 1 ? 1 : from) - 1;
+  int16_t level = cfg.level;
+
+  if (cfg.slope == TRIG_RISING) {
+    // Wait until the signal is clearly below the level...
+    int16_t arm = level - cfg.hysteresis;
+    while (i < to && buf[i] >= arm) {
+      i++;
+    }
+    // ...then for the first sample at or above it.
+    while (++i < to && buf[i] < level) {
+    }
+    if (i >= to) {
+      return -1;
+    }
+    return crossing(i, buf[i - 1], buf[i], level, cfg.interpolate);
+  }
+
+  // Falling edge: same search with the signal mirrored around the level.
+  int16_t arm = level + cfg.hysteresis;
+  while (i < to && buf[i] <= arm) {
+    i++;
+  }
+  while (++i < to && buf[i] > level) {
+  }
+  if (i >= to) {
+    return -1;
+  }
+  return crossing(i, -buf[i - 1], -buf[i], -level, cfg.interpolate);
+}
+
+void triggerWindow(int16_t *dst, const int16_t *src, int32_t startQ8,
+                   int count) {
+  const int16_t *s = src + (startQ8 >> 8);
+  int32_t frac = startQ8 & 0xFF;
+
+  if (frac == 0) {
+    for (int k = 0; k < count; k++) {
+      dst[k] = s[k];
+    }
+    return;
+  }
+  for (int k = 0; k < count; k++) {
+    dst[k] = (int16_t)(s[k] + (((s[k + 1] - s[k]) * frac) >> 8));
+  }
+}
+
+TriggerAction triggerUpdate(TriggerState &state, const TriggerConfig &cfg,
+                            bool found, uint32_t nowMs) {
+  switch (cfg.mode) {
+  case TRIG_SINGLE:
+    if (!state.armed || !found) {
+      return TRIG_SKIP;
+    }
+    state.armed = false;
+    return TRIG_SHOW;
+
+  case TRIG_NORMAL:
+    return found ? TRIG_SHOW : TRIG_SKIP;
+
+  case TRIG_AUTO:
+  default:
+    if (found) {
+      state.lastTrigMs = nowMs;
+      return TRIG_SHOW;
+    }
+    if (nowMs - state.lastTrigMs >= TRIG_AUTO_TIMEOUT_MS) {
+      return TRIG_SHOW_FREE;
+    }
+    return TRIG_SKIP;
+  }
+}
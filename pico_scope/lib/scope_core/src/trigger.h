@@ -0,0 +1,65 @@
+#ifndef TRIGGER_H
+#define TRIGGER_H
+
+#include <stdint.h>
+
+// ── Trigger engine ──────────────────────────────────────────
+// Edge trigger with hysteresis on either channel. The search kernel is
+// integer-only and returns the crossing in 1/256 sample units (Q8) so the
+// displayed window can be positioned with sub-sample precision.
+
+enum TriggerSlope : uint8_t { TRIG_RISING, TRIG_FALLING };
+
+enum TriggerMode : uint8_t {
+  TRIG_AUTO,   // show untriggered frames when no trigger shows up in time
+  TRIG_NORMAL, // only show triggered frames
+  TRIG_SINGLE  // show one triggered frame, then hold until re-armed
+};
+
+struct TriggerConfig {
+  int16_t level;       // ADC code, or TRIG_LEVEL_AUTO
+  int16_t hysteresis;  // codes the signal must move past level to re-arm
+  TriggerSlope slope;
+  uint8_t source;      // 0 = CH1, 1 = CH2
+  TriggerMode mode;
+  uint8_t preTrigger;  // part of the window shown before the trigger, /256
+  bool interpolate;    // sub-sample crossing position
+};
+
+// Mode state carried from one acquisition to the next.
+struct TriggerState {
+  bool armed;          // single mode: waiting for a trigger
+  uint32_t lastTrigMs; // auto mode: time of the last trigger
+};
+
+// What to do with an acquisition after the search.
+enum TriggerAction : uint8_t {
+  TRIG_SHOW,      // triggered frame
+  TRIG_SHOW_FREE, // untriggered frame (auto mode timeout)
+  TRIG_SKIP       // nothing to show, capture again
+};
+
+TriggerConfig triggerDefaults();
+
+// Resolve an auto level to 50 % of the peak-to-peak of buf[0..len), and
+// widen the hysteresis with the signal swing (manual levels too). Returns
+// the config actually used.
+TriggerConfig triggerResolve(const TriggerConfig &cfg, const int16_t *buf,
+                             int len);
+
+// Search for the first crossing between buf[i - 1] and buf[i], from <= i < to.
+// The signal has to be past level - hysteresis (level + hysteresis when
+// falling) before a crossing counts. Returns the Q8 position or -1.
+int32_t triggerFind(const int16_t *buf, int from, int to,
+                     const TriggerConfig &cfg);
+
+// Copy `count` samples starting at Q8 position startQ8, interpolating
+// linearly between neighbours. Reads src[0 .. (startQ8 >> 8) + count].
+void triggerWindow(int16_t *dst, const int16_t *src, int32_t startQ8,
+                   int count);
+
+// Advance the mode state machine after a search (found = crossing found).
+TriggerAction triggerUpdate(TriggerState &state, const TriggerConfig &cfg,
+                            bool found, uint32_t nowMs);
+
+#endif // TRIGGER_H
@@ -0,0 +1,31 @@
+#include "ymap.h"
+
+void ymapInit(YMap &m) { m.gainQ32 = -1; }
+
+bool ymapSetScale(YMap &m, float vdivScale) {
+  // Same mapping as the original float code: normalise to ±1 over half the
+  // ADC range, divide by the scale, clamp, then flip (Y=0 is top). The
+  // gain is rounded down in Q32, so codes that land exactly on a row
+  // boundary (full scale, for one) stay on it as they do in float; a Q16
+  // gain put 28 of them a row off at vscale 1.
+  int64_t gain = (int64_t)((WAVEFORM_H / 2) * 4294967296.0 /
+                           ((ADC_MAX / 2) * (double)vdivScale));
+  if (gain == m.gainQ32) {
+    return false;
+  }
+  m.gainQ32 = gain;
+
+  const int64_t limit = (int64_t)(WAVEFORM_H / 2) << 32;
+  const int32_t centre = WAVEFORM_TOP + WAVEFORM_H / 2;
+  for (int32_t d = -ADC_MAX; d <= ADC_MAX; d++) {
+    int64_t v = d * gain;
+    if (v > limit) {
+      v = limit;
+    } else if (v < -limit) {
+      v = -limit;
+    }
+    // centre - v, truncated like the float version: centre - ceil(v)
+    m.y[d + ADC_MAX] = (uint8_t)(centre + (int32_t)((-v) >> 32));
+  }
+  return true;
+}
@@ -0,0 +1,31 @@
+#ifndef YMAP_H
+#define YMAP_H
+
+#include <stdint.h>
+
+#include "config.h"
+
+// ── ADC → pixel mapping ─────────────────────────────────────
+// The RP2040 has no FPU, so mapping every sample with float math is slow.
+// Instead the mapping is a lookup table indexed by the sample's distance to
+// the channel's DC offset (-ADC_MAX .. +ADC_MAX). Offsets only shift the
+// index, so the table is shared by both channels and only rebuilt when the
+// V/div scale changes.
+
+struct YMap {
+  int64_t gainQ32;              // pixels per ADC code, Q32 (-1 = not built)
+  uint8_t y[2 * ADC_MAX + 1];   // Y for (adcVal - midADC + ADC_MAX)
+};
+
+void ymapInit(YMap &m);
+
+// Rebuild the table for a vertical scale (1.0 = full range fills the
+// waveform area). Returns false if the scale didn't change.
+bool ymapSetScale(YMap &m, float vdivScale);
+
+// Y pixel of an ADC value for a channel centred on midADC.
+inline uint8_t ymapLookup(const YMap &m, int16_t adcVal, int16_t midADC) {
+  return m.y[adcVal - midADC + ADC_MAX];
+}
+
+#endif // YMAP_H
@@ -17,6 +17,10 @@
 //    SDA   → GP4
 //    SCL   → GP5
 //
+//  Buttons (to GND)
+//    Trigger    → GP14   (press: mode / re-arm, hold: slope + source)
+//    Mode       → GP13   (press: next display mode)
+//
 //  Inputs
 //    Channel 1  → GP26 (A0)
 //    Channel 2  → GP27 (A1)
@@ -36,106 +40,537 @@
 // #include <SPI.h>
 #include <U8g2lib.h>
 
+#include "average.h"
+#include "capture.h"
+#include "config.h"
+#include "dirty.h"
+#include "ets.h"
+#include "fft.h"
+#include "frame.h"
+#include "measure.h"
+#include "peak.h"
+#include "persist.h"
+#include "profile.h"
+#include "raster.h"
+#include "roll.h"
+#include "segment.h"
+#include "stream.h"
+#include "trigger.h"
+#include "ymap.h"
+
 // ── Display constructor (SH1106, hardware SPI/I2C) ──────────────
 // U8G2_SH1106_128X64_NONAME_F_4W_HW_SPI
 // display(U8G2_R0, /* cs= */ 17, /* dc= */ 16, /* rst= */ 15);
 U8G2_SH1106_128X64_NONAME_F_HW_I2C display(U8G2_R0, /* reset= */ U8X8_PIN_NONE);
 
-// ── ADC pins ────────────────────────────────────────────────
-#define PIN_CH1 A2     // GP28
-#define PIN_CH2 A3     // GP29
-#define PIN_TIMEDIV A0 // GP26
-#define PIN_VOLTDIV A1 // GP27
-
-// ── Oscilloscope settings ───────────────────────────────────
-#define SCREEN_W 128
-#define SCREEN_H 64
-#define STATUS_Y 5                           // Y position for T/V text at top
-#define WAVEFORM_TOP 8                       // top of waveform area (pixels)
-#define WAVEFORM_H (SCREEN_H - WAVEFORM_TOP) // waveform height in pixels
-#define SAMPLES SCREEN_W                     // one sample per horizontal pixel
-
-// Vertical scaling: assume at vdiv_scale = 1.0 the screen shows 10 Vpp.
-// With 8 vertical divisions, that means 10/8 V per division at vdiv_scale = 1.0.
-// At other scales, V/div is (BASE_VPP_AT_VSCALE_1 * vdiv_scale) / VERTICAL_DIVS.
-#define VERTICAL_DIVS 8
-#define BASE_VPP_AT_VSCALE_1 10.0f
-
-// ADC mid-scale (Pico = 12-bit → 0–4095, mid = ~2048)
-// After op-amp conditioning a 0V eurorack signal should land here
-#define ADC_MID 2048
-#define ADC_MAX 4095
-
-// Time/Div range : min and max microseconds between samples
-#define TDIV_MIN_US 20
-#define TDIV_MAX_US 5000
-
-// Trigger: rising edge, search window in samples
-#define TRIGGER_SEARCH 512 // max samples to scan for trigger
-
-// ── Sample buffers ──────────────────────────────────────────
-int16_t buf1[SAMPLES];
-int16_t buf2[SAMPLES];
+// Capture window: displayed samples plus the trigger search area
+#define CAPTURE_LEN (SAMPLES + TRIGGER_SEARCH)
+
+// ── Display updates (core0) ─────────────────────────────────
+// Only the changed part of each SH1106 page is transmitted.
+DirtyTracker dirty;
+
+// Frame-rate counter, refreshed once per second
+uint32_t displayFrames = 0;
+uint32_t displayBytes = 0;
+uint32_t displayStatsMs = 0;
+uint16_t displayFps = 0;
+uint32_t displayBytesPerFrame = 0;
+
+// ── Frame pipeline ──────────────────────────────────────────
+// Core1 owns the ADC: it reads the pots, captures and triggers into the back
+// frame. Core0 draws the previous frame and pushes it to the display, so the
+// scope keeps acquiring during the (slow) I2C transfer.
+FrameExchange frames;
+
+// Capture buffers (static: core1 only has a small stack)
+int16_t captureBuf1[CAPTURE_LEN];
+int16_t captureBuf2[CAPTURE_LEN];
+int16_t captureMin1[CAPTURE_LEN]; // peak detect envelopes
+int16_t captureMax1[CAPTURE_LEN];
+int16_t captureMin2[CAPTURE_LEN];
+int16_t captureMax2[CAPTURE_LEN];
+
+// Roll mode state, kept across frames while the time base stays slow
+RollBuffer roll1;
+RollBuffer roll2;
+bool rolling = false;
+
+// Averaging mode state, kept across frames while the time base is unchanged
+Averager averager;
+bool averaging = false;
+uint32_t averageIntervalUs = 0;
+
+// Equivalent-time record, kept while the time base and trigger are unchanged
+EtsRecord etsRecord;
+bool etsActive = false;
+uint32_t etsIntervalUs = 0;
+uint8_t etsTrigger = 0; // source and slope the record was built with
+
+// Segmented memory: one burst of trigger events, held until re-armed
+SegmentMemory segments;
+bool segArmed = true;        // capture a new burst on the next frame
+uint8_t segView = 0;         // 0 = overlay, else segment number
+uint32_t segIntervalUs = 0;  // sample interval of the stored burst
+TriggerConfig segTrig;       // resolved trigger of the stored burst
+
+// Persistence mode state (core0), cleared when the scales change
+Persistence persistence;
+bool persisting = false;
+uint32_t persistIntervalUs = 0;
+float persistScale = 0.0f;
 
 // ── Helpers ─────────────────────────────────────────────────
 
+// ADC → Y lookup table (core0), rebuilt when the V/div scale changes
+YMap ymap;
+
 // Map an ADC value to a Y pixel coordinate inside the waveform area.
-// vdiv_scale: 1.0 = full range fills screen, 0.5 = zoomed in x2, etc.
 // midADC: per-channel DC offset (average ADC value for this frame).
-int16_t adcToY(int16_t adcVal, float vdiv_scale, int16_t midADC) {
-  // Centre around midADC, scale, then flip (Y=0 is top)
-  float normalized = (adcVal - midADC) / (float)(ADC_MAX / 2); // -1.0 .. +1.0
-  normalized /= vdiv_scale;                                    // apply zoom
-  normalized = constrain(normalized, -1.0f, 1.0f);
-  return (int16_t)(WAVEFORM_TOP + (WAVEFORM_H / 2) -
-                   normalized * (WAVEFORM_H / 2));
+inline int16_t adcToY(int16_t adcVal, int16_t midADC) {
+  return ymapLookup(ymap, adcVal, midADC);
+}
+
+// Peak detect and roll mode run the ADC at full speed on both channels, one
+// pair every 2 * ADC_MIN_CYCLES, and reduce a whole number of pairs to each
+// column: the number closest to the requested interval.
+uint32_t pairsPerColumn(uint32_t intervalUs) {
+  const uint32_t pairCycles = 2 * ADC_MIN_CYCLES;
+  return (intervalUs * ADC_CLOCK_MHZ + pairCycles / 2) / pairCycles;
+}
+
+// Column interval those pairs actually span (exact: a pair is 4 us).
+uint32_t columnIntervalUs(uint32_t pairs) {
+  return pairs * 2 * ADC_MIN_CYCLES / ADC_CLOCK_MHZ;
+}
+
+// Pot reading with a deadband against ADC noise.
+int readPot(uint8_t pin, int &last) {
+  int raw = analogRead(pin);
+  if (raw > last + POT_DEADBAND || raw < last - POT_DEADBAND) {
+    last = raw;
+  }
+  return last;
+}
+
+// ── Buttons (core1) ─────────────────────────────────────────
+enum ButtonEvent : uint8_t { BUTTON_NONE, BUTTON_SHORT, BUTTON_LONG };
+
+struct Button {
+  uint8_t pin;
+  bool down;
+  bool used; // the hold adjusted something: no event on release
+  uint32_t downMs;
+};
+
+Button trigButton = {PIN_TRIG_BTN, false, false, 0};
+Button modeButton = {PIN_MODE_BTN, false, false, 0};
+
+// Debounced press detection; events fire on release.
+ButtonEvent pollButton(Button &b) {
+  bool pressed = digitalRead(b.pin) == LOW;
+  uint32_t now = millis();
+
+  if (pressed && !b.down) {
+    b.down = true;
+    b.used = false;
+    b.downMs = now;
+    return BUTTON_NONE;
+  }
+  if (pressed || !b.down) {
+    return BUTTON_NONE;
+  }
+
+  // Released
+  b.down = false;
+  uint32_t held = now - b.downMs;
+  if (held < BUTTON_DEBOUNCE_MS || b.used) {
+    return BUTTON_NONE; // contact bounce
+  }
+  return (held >= BUTTON_LONG_MS) ? BUTTON_LONG : BUTTON_SHORT;
 }
 
-// Find a rising-edge trigger point in a pre-filled oversize buffer.
-// Returns the starting index or 0 if not found.
-int findTrigger(int16_t *buf, int bufLen) {
-  int midADC = ADC_MID;
-  for (int i = 1; i < bufLen - SAMPLES; i++) {
-    if (buf[i - 1] < midADC && buf[i] >= midADC) {
-      return i;
+// ── Trigger and mode control (core1) ────────────────────────
+TriggerConfig trigCfg = triggerDefaults();
+TriggerState trigState = {true, 0};
+DisplayMode displayMode = MODE_SCOPE;
+
+// Trigger button: a short press steps AUTO → NORMAL → SINGLE, or re-arms a
+// single shot that has already fired. A long press steps through the
+// slope/source combinations R1 → F1 → R2 → F2. Turning the V/div pot while
+// the button is held sets the level instead (see potControls()).
+//
+// In segmented memory mode a short press pages through the segments
+// (overlay → 1 → 2 ...) and a long press re-arms a new burst instead.
+// Returns true if the button was pressed.
+bool pollTriggerButton() {
+  ButtonEvent ev = pollButton(trigButton);
+  if (ev == BUTTON_NONE) {
+    return false;
+  }
+
+  if (displayMode == MODE_SEGMENT) {
+    if (ev == BUTTON_LONG) {
+      segArmed = true;
+    } else {
+      segView = (segView + 1) % (segments.count + 1);
+    }
+    return true;
+  }
+
+  if (ev == BUTTON_LONG) {
+    if (trigCfg.slope == TRIG_RISING) {
+      trigCfg.slope = TRIG_FALLING;
+    } else {
+      trigCfg.slope = TRIG_RISING;
+      trigCfg.source ^= 1;
     }
+    return true;
   }
-  return 0; // no trigger found, display from start
+
+  if (trigCfg.mode == TRIG_SINGLE && !trigState.armed) {
+    trigState.armed = true;
+    return true;
+  }
+  trigCfg.mode = (TriggerMode)((trigCfg.mode + 1) % 3);
+  trigState.armed = true;
+  trigState.lastTrigMs = millis();
+  return true;
 }
 
-// ── Setup ────────────────────────────────────────────────────
-void setup() {
-  analogReadResolution(12); // Pico supports 12-bit ADC
+#if PROFILE_ENABLED
+bool profileOverlay = false; // show the profiling overlay
+#endif
 
-  display.begin();
-  display.setFont(u8g2_font_4x6_tr); // tiny font for status bar
-  display.setDrawColor(1);
+// Mode button: a short press steps through the display modes (a long one
+// toggles the profiling overlay when PROFILE_ENABLED). Returns true if the
+// button was pressed.
+bool pollModeButton() {
+  ButtonEvent ev = pollButton(modeButton);
+#if PROFILE_ENABLED
+  if (ev == BUTTON_LONG) {
+    profileOverlay = !profileOverlay;
+  }
+#endif
+  if (ev == BUTTON_SHORT) {
+    displayMode = (DisplayMode)((displayMode + 1) % MODE_COUNT);
+    if (displayMode == MODE_SEGMENT) {
+      segArmed = true; // start with a fresh burst
+    }
+  }
+  return ev != BUTTON_NONE;
+}
 
-  // Brief splash (centered)
-  display.clearBuffer();
+// Both buttons; true if either was pressed. Segmented captures poll this
+// while they wait for triggers (up to SEG_TIMEOUT_MS) and stop on a press,
+// so presses are neither lost nor stretched into long ones.
+bool pollButtons() {
+  bool trig = pollTriggerButton();
+  bool mode = pollModeButton();
+  return trig || mode;
+}
 
-  const char *title = "PICO SCOPE";
-  display.setFont(u8g2_font_6x10_tr);
-  int titleW = display.getStrWidth(title);
-  int titleX = (SCREEN_W - titleW) / 2;
-  int titleY = (SCREEN_H / 2) - 2;
-  display.drawStr(titleX, titleY, title);
+// Trigger level for a V/div pot reading: AUTO at the bottom end.
+int16_t levelFromPot(int raw) {
+  if (raw < TRIG_POT_AUTO) {
+    return TRIG_LEVEL_AUTO;
+  }
+  return (int16_t)((raw - TRIG_POT_AUTO) * ADC_MAX / (4095 - TRIG_POT_AUTO));
+}
 
-  display.setFont(u8g2_font_4x6_tr);
-  int verW = display.getStrWidth(VERSION);
-  int verX = (SCREEN_W - verW) / 2;
-  int verY = titleY + 10;
-  display.drawStr(verX, verY, VERSION);
+// The V/div pot doubles as the trigger level control: while the trigger
+// button is held and the pot moves, it sets trigCfg.level and the release
+// doesn't count as a press. V/div keeps its setting meanwhile and only
+// follows the pot again once it is back near that setting, so it doesn't
+// jump. Returns the V/div reading to use.
+int potControls(int voltPotRaw, Frame &f) {
+  static int vdivRaw = -1;
+  static bool pickup = false; // waiting for the pot to come back to vdivRaw
+  static int holdRaw = -1;    // pot reading when the button went down
 
-  display.sendBuffer();
-  delay(2000);
+  if (vdivRaw < 0) {
+    vdivRaw = voltPotRaw;
+  }
+  bool adjusting = false;
+  if (trigButton.down && displayMode != MODE_XY && displayMode != MODE_FFT) {
+    if (holdRaw < 0) {
+      holdRaw = voltPotRaw;
+    }
+    if (trigButton.used || voltPotRaw != holdRaw) {
+      trigButton.used = true;
+      trigCfg.level = levelFromPot(voltPotRaw);
+      adjusting = true;
+      pickup = true;
+    }
+  } else {
+    holdRaw = -1;
+  }
+
+  bool near = voltPotRaw <= vdivRaw + 2 * POT_DEADBAND &&
+              voltPotRaw >= vdivRaw - 2 * POT_DEADBAND;
+  if (!adjusting && (!pickup || near)) {
+    vdivRaw = voltPotRaw;
+    pickup = false;
+  }
+  f.levelAdjust = adjusting;
+  return vdivRaw;
 }
 
-// ── Main loop ────────────────────────────────────────────────
-void loop() {
+// Compute per-channel DC offsets so each waveform is vertically centered.
+void computeOffsets(Frame &f) {
+  long sum1 = 0;
+  long sum2 = 0;
+  for (int i = f.firstX; i < SAMPLES; i++) {
+    sum1 += f.ch1[i];
+    sum2 += f.ch2[i];
+  }
+  int n = SAMPLES - f.firstX;
+  f.mid1 = (n > 0) ? (int16_t)(sum1 / n) : ADC_MID;
+  f.mid2 = (n > 0) ? (int16_t)(sum2 / n) : ADC_MID;
+}
+
+// Stream one roll-mode frame worth of samples and show the newest columns
+// (core1). Roll mode is untriggered, so there is always a frame to show.
+void acquireRoll(Frame &f) {
+  // Both channels at full speed; the frame reports the interval the
+  // columns really span, so labels and measurements match the trace
+  uint32_t perColumn = pairsPerColumn(f.intervalUs);
+  f.intervalUs = columnIntervalUs(perColumn);
+  if (!rolling) {
+    rollBegin(roll1, perColumn);
+    rollBegin(roll2, perColumn);
+    rolling = true;
+  } else {
+    rollSetRate(roll1, perColumn);
+    rollSetRate(roll2, perColumn);
+  }
+
+  CaptureTiming fastest = {f.intervalUs, ADC_MIN_CYCLES, 1, 2};
+  uint32_t framePairs =
+      ROLL_FRAME_MS * 1000 * ADC_CLOCK_MHZ / (2 * ADC_MIN_CYCLES);
+  PROFILE_BEGIN(PROF_CAPTURE);
+  captureStartDual(PIN_CH1, PIN_CH2, fastest);
+  peakStreamDual(roll1.reducer, roll2.reducer, captureHead(), framePairs);
+  captureStop();
+  PROFILE_END(PROF_CAPTURE);
+
+  f.firstX = rollCopy(roll1, f.ch1Min, f.ch1Max, f.ch1);
+  rollCopy(roll2, f.ch2Min, f.ch2Max, f.ch2);
+
+  f.peak = true;
+  f.rolling = true;
+  f.triggered = false;
+  f.holding = false;
+
+  // Resolve the trigger (an auto level for the level tick) and measure the
+  // trigger source over what is on screen
+  const int16_t *src = (trigCfg.source == 0) ? f.ch1 : f.ch2;
+  int n = SAMPLES - f.firstX;
+  f.trig = trigCfg;
+  if (n > 0) {
+    f.trig = triggerResolve(trigCfg, src + f.firstX, n);
+    measure(f.meas, src + f.firstX, n, f.trig.level, f.trig.hysteresis,
+            f.intervalUs);
+  } else {
+    if (f.trig.level == TRIG_LEVEL_AUTO) {
+      f.trig.level = ADC_MID; // nothing on screen yet: the centre line
+    }
+    f.meas = Measurements();
+  }
+}
+
+// ── USB streaming (core1) ───────────────────────────────────
+uint32_t streamSeq = 0;
+
+// Send the raw capture that ends at ring index `end` to the host (see
+// stream.h), straight from the DMA ring. Blocks at USB speed on core1 only,
+// so the display keeps running; nothing is sent while no host has the
+// port open.
+void streamCapture(uint32_t end, int32_t trigQ8, uint32_t intervalUs) {
+#if STREAM_SERIAL
+  if (!Serial) {
+    return;
+  }
+
+  const uint32_t words = 2 * CAPTURE_LEN; // interleaved pairs
+  uint32_t start = ((end & ~1u) - words) & CAPTURE_RING_MASK;
+  uint32_t first = CAPTURE_RING_LEN - start; // words before the ring wraps
+  if (first > words) {
+    first = words;
+  }
+  const volatile uint16_t *ring = captureRing();
+
+  StreamHeader h;
+  uint16_t trigIndex =
+      (trigQ8 >= 0) ? (uint16_t)(trigQ8 >> 8) : STREAM_NO_TRIGGER;
+  streamHeader(h, streamSeq++, micros(), intervalUs * 1000, CAPTURE_LEN, 2,
+               trigIndex);
+
+  StreamChecksum sum;
+  streamChecksumBegin(sum);
+  streamChecksumAdd(sum, &h, sizeof(h));
+  streamChecksumAdd(sum, ring + start, first * 2);
+  streamChecksumAdd(sum, ring, (words - first) * 2);
+  uint16_t check = streamChecksumValue(sum);
+
+  // The capture is stopped, so the ring holds still until the next start
+  Serial.write((const uint8_t *)&h, sizeof(h));
+  Serial.write((const uint8_t *)(ring + start), first * 2);
+  if (words > first) {
+    Serial.write((const uint8_t *)ring, (words - first) * 2);
+  }
+  Serial.write((const uint8_t *)&check, sizeof(check));
+#else
+  (void)end;
+  (void)trigQ8;
+  (void)intervalUs;
+#endif
+}
+
+// Blend the frame's window into the running average and replace it with
+// the result (core1). Changing the time base restarts the average.
+void averageFrame(Frame &f) {
+  if (!averaging || f.intervalUs != averageIntervalUs) {
+    averageReset(averager);
+    averageIntervalUs = f.intervalUs;
+    averaging = true;
+  }
+  averageTrace(averager, 0, f.ch1);
+  averageTrace(averager, 1, f.ch2);
+  if (f.peak) {
+    averageTrace(averager, 2, f.ch1Min);
+    averageTrace(averager, 3, f.ch1Max);
+    averageTrace(averager, 4, f.ch2Min);
+    averageTrace(averager, 5, f.ch2Max);
+  }
+  averageNext(averager);
+}
+
+// Bin the capture into the equivalent-time record around the trigger at
+// Q8 position `trigQ8` and show the record instead of the window (core1).
+void etsFrame(Frame &f, int32_t trigQ8, int pre) {
+  uint8_t trigger = (uint8_t)(trigCfg.source << 1 | trigCfg.slope);
+  if (!etsActive || f.intervalUs != etsIntervalUs || trigger != etsTrigger) {
+    etsReset(etsRecord);
+    etsIntervalUs = f.intervalUs;
+    etsTrigger = trigger;
+    etsActive = true;
+  }
+  etsAdd(etsRecord, captureBuf1, captureBuf2, CAPTURE_LEN, trigQ8, pre);
+  etsRender(etsRecord, f.ch1, f.ch2);
+  f.ets = ETS_FACTOR;
+}
+
+// Segmented memory mode (core1): capture a burst when armed, then show the
+// selected segment, or all of them overlaid as an envelope.
+bool acquireSegments(Frame &f) {
+  rolling = false;
+
+  if (segArmed) {
+    // The trigger is searched while streaming, so no oversampling: clamp
+    // slower time bases to the slowest hardware rate.
+    CaptureTiming timing = captureTiming(f.intervalUs, 2);
+    if (timing.oversample > 1) {
+      timing.oversample = 1;
+      timing.cycles = ADC_MAX_CYCLES;
+      timing.intervalUs = 2 * ADC_MAX_CYCLES / ADC_CLOCK_MHZ;
+    }
+
+    // Resolve the trigger level on a regular capture first. At the slowest
+    // rate that takes 1.7 s, so wait in short pieces and keep polling the
+    // buttons, as segmentCapture() does.
+    captureStartDual(PIN_CH1, PIN_CH2, timing);
+    const uint32_t piece = 32; // conversions: 44 ms at the slowest rate
+    uint32_t end = captureHead();
+    for (uint32_t left = 2 * CAPTURE_LEN; left > 0;) {
+      uint32_t n = (left < piece) ? left : piece;
+      end = captureWait(end, n);
+      left -= n;
+      if (pollButtons()) {
+        captureStop();
+        return false; // stay armed
+      }
+    }
+    captureStop();
+    captureCopyDual(captureBuf1, captureBuf2, end, CAPTURE_LEN, 1);
+    const int16_t *src = (trigCfg.source == 0) ? captureBuf1 : captureBuf2;
+    segTrig = triggerResolve(trigCfg, src, CAPTURE_LEN);
+    segTrig.preTrigger = SEG_PRE * 256 / SAMPLES;
+
+    uint32_t timeoutPairs = SEG_TIMEOUT_MS * 1000 / timing.intervalUs;
+    if (segmentCapture(segments, segTrig, timing, timeoutPairs,
+                       pollButtons) == 0) {
+      return false; // no trigger yet (or a button press), stay armed
+    }
+    segArmed = false;
+    segView = 0;
+    segIntervalUs = timing.intervalUs;
+  }
+  if (segments.count == 0) {
+    return false;
+  }
+  if (segView > segments.count) {
+    segView = 0;
+  }
+
+  f.intervalUs = segIntervalUs;
+  f.trig = segTrig;
+  f.triggered = true;
+  f.holding = false;
+  f.seg.index = segView;
+  f.seg.count = segments.count;
+  f.seg.deadUs = segments.deadUs;
+  if (segView == 0) {
+    segmentOverlay(segments, f.ch1, f.ch1Min, f.ch1Max, f.ch2, f.ch2Min,
+                   f.ch2Max);
+    f.peak = true;
+    f.seg.timeUs = segments.seg[segments.count - 1].timeUs;
+  } else {
+    const Segment &s = segments.seg[segView - 1];
+    for (int i = 0; i < SAMPLES; i++) {
+      f.ch1[i] = s.ch1[i];
+      f.ch2[i] = s.ch2[i];
+    }
+    f.peak = false;
+    f.seg.timeUs = s.timeUs;
+  }
+
+  const int16_t *src = (segTrig.source == 0) ? f.ch1 : f.ch2;
+  measure(f.meas, src, SAMPLES, segTrig.level, segTrig.hysteresis,
+          f.intervalUs);
+  computeOffsets(f);
+  return true;
+}
+
+// Capture FFT_N samples of CH1 and compute the spectrum (core1). The
+// spectrum is untriggered; oversampling at slow time bases doubles as a
+// crude anti-aliasing filter.
+void acquireSpectrum(Frame &f) {
+  CaptureTiming timing = captureTiming(f.intervalUs);
+
+  PROFILE_BEGIN(PROF_CAPTURE);
+  captureStart(PIN_CH1, timing);
+  uint32_t end = captureWait(captureHead(), FFT_N * timing.oversample);
+  captureStop();
+  captureCopy(captureBuf1, end, FFT_N, timing.oversample);
+  PROFILE_END(PROF_CAPTURE);
+
+  PROFILE_BEGIN(PROF_FFT);
+  fftSpectrum(f.spectrum, captureBuf1, f.intervalUs);
+  PROFILE_END(PROF_FFT);
+}
+
+// Read pots, capture and trigger one frame (core1).
+// Returns false when there is nothing to show (no trigger yet).
+bool acquireFrame(Frame &f) {
   // 1. Read pots ─────────────────────────────────────────────
-  int timePotRaw = analogRead(PIN_TIMEDIV); // 0–4095
-  int voltPotRaw = analogRead(PIN_VOLTDIV); // 0–4095
+  PROFILE_BEGIN(PROF_POTS);
+  static int timePotLast = -POT_DEADBAND - 1;
+  int timePotRaw = readPot(PIN_TIMEDIV, timePotLast); // 0–4095
+  static int voltPotLast = -POT_DEADBAND - 1;
+  int voltPotRaw = readPot(PIN_VOLTDIV, voltPotLast); // 0–4095
+  voltPotRaw = potControls(voltPotRaw, f);
+  PROFILE_END(PROF_POTS);
 
   // Time/Div: map pot to sample interval in microseconds
   uint32_t sampleDelayUs = map(timePotRaw, 0, 4095, TDIV_MIN_US, TDIV_MAX_US);
@@ -143,78 +578,265 @@ void loop() {
   // Volts/Div: map pot to a vertical scale factor
   //   pot=0   → vscale=0.25 (zoomed in, small signals fill screen)
   //   pot=max → vscale=2.0  (zoomed out, ±10V fits)
-  float vdiv_scale = 0.25f + (voltPotRaw / 4095.0f) * 1.75f;
+  f.vdivScale = 0.25f + (voltPotRaw / 4095.0f) * 1.75f;
+  f.intervalUs = sampleDelayUs;
+  f.rolling = false;
+  f.firstX = 0;
+  f.mode = displayMode;
+#if PROFILE_ENABLED
+  f.profile = profileOverlay;
+#endif
+  f.ets = 1;
+  if (f.mode != MODE_AVERAGE) {
+    averaging = false; // start over when the mode comes back
+  }
+  if (f.mode != MODE_ETS) {
+    etsActive = false;
+  }
 
-  // 2. Capture with trigger ──────────────────────────────────
-  // Oversample into a larger buffer so we can search for trigger
-  int16_t captureBuf1[SAMPLES + TRIGGER_SEARCH];
-  int16_t captureBuf2[SAMPLES + TRIGGER_SEARCH];
+  if (f.mode == MODE_FFT) {
+    rolling = false; // restart the roll trace when switching back
+    acquireSpectrum(f);
+    return true;
+  }
+  if (f.mode == MODE_SEGMENT) {
+    return acquireSegments(f);
+  }
+
+  if (sampleDelayUs >= ROLL_MIN_US) {
+    acquireRoll(f);
+    computeOffsets(f);
+    return true;
+  }
+  rolling = false;
 
-  for (int i = 0; i < SAMPLES + TRIGGER_SEARCH; i++) {
-    // CH1 (hardware inverted)
-    captureBuf1[i] = ADC_MAX - analogRead(PIN_CH1);
+  // 2. Capture ───────────────────────────────────────────────
+  // The ADC free-runs into the DMA ring at a hardware-paced rate; we only
+  // wait for enough fresh samples, then copy the window out.
+  // Slow time bases run the ADC at full speed and reduce each column to its
+  // min/max/mean on the fly (peak detect).
+  f.peak = sampleDelayUs >= PEAK_DETECT_MIN_US;
+  PROFILE_BEGIN(PROF_CAPTURE);
 
-    // CH2 (hardware not implemented yet)
-    // captureBuf2[i] = ADC_MAX - analogRead(PIN_CH2);
-    captureBuf2[i] = 0.0f;
+  // Both channels are converted in turn (ADC round-robin) into one
+  // interleaved stream, so they share a time base.
+  uint32_t end = 0; // ring index past the newest sample (sampled captures)
+  if (f.peak) {
+    uint32_t perColumn = pairsPerColumn(sampleDelayUs);
+    sampleDelayUs = columnIntervalUs(perColumn);
+    f.intervalUs = sampleDelayUs; // the achieved interval, see pairsPerColumn
+    CaptureTiming fastest = {sampleDelayUs, ADC_MIN_CYCLES, 1, 2};
+    PeakReducer reducer1;
+    PeakReducer reducer2;
+    peakBegin(reducer1, captureMin1, captureMax1, captureBuf1, CAPTURE_LEN,
+              perColumn);
+    peakBegin(reducer2, captureMin2, captureMax2, captureBuf2, CAPTURE_LEN,
+              perColumn);
 
-    if (sampleDelayUs > 0)
-      delayMicroseconds(sampleDelayUs);
+    captureStartDual(PIN_CH1, PIN_CH2, fastest);
+    peakCaptureDual(reducer1, reducer2, captureHead());
+    captureStop();
+  } else {
+    CaptureTiming timing = captureTiming(sampleDelayUs, 2);
+
+    captureStartDual(PIN_CH1, PIN_CH2, timing);
+    end = captureWait(captureHead(), 2 * CAPTURE_LEN * timing.oversample);
+    captureStop(); // frees the ADC for the pot reads of the next frame
+
+    // De-interleave, invert and re-align CH2 onto CH1's sample instants
+    captureCopyDual(captureBuf1, captureBuf2, end, CAPTURE_LEN,
+                    timing.oversample);
   }
+  PROFILE_END(PROF_CAPTURE);
 
-  // Find rising-edge trigger on CH1
-  int trigIdx = findTrigger(captureBuf1, SAMPLES + TRIGGER_SEARCH);
+  // 3. Trigger ───────────────────────────────────────────────
+  // Keep `pre` samples of history before the crossing, so only search where
+  // the whole window fits in the capture buffer.
+  PROFILE_BEGIN(PROF_TRIGGER);
+  int pre = (SAMPLES * trigCfg.preTrigger) >> 8;
+  const int16_t *src = trigCfg.source == 0 ? captureBuf1 : captureBuf2;
+  TriggerConfig cfg = triggerResolve(trigCfg, src, CAPTURE_LEN);
+  int32_t pos = triggerFind(src, pre + 1, CAPTURE_LEN - SAMPLES + pre + 1, cfg);
 
-  // Copy triggered window into display buffers
-  for (int i = 0; i < SAMPLES; i++) {
-    buf1[i] = captureBuf1[trigIdx + i];
-    buf2[i] = captureBuf2[trigIdx + i];
+  TriggerAction action = triggerUpdate(trigState, cfg, pos >= 0, millis());
+  PROFILE_END(PROF_TRIGGER);
+  if (!f.peak) {
+    streamCapture(end, pos, sampleDelayUs);
+  }
+  if (action == TRIG_SKIP) {
+    return false;
   }
 
-  // Compute per-channel DC offsets so each waveform is vertically centered
-  long sum1 = 0;
-  long sum2 = 0;
-  for (int i = 0; i < SAMPLES; i++) {
-    sum1 += buf1[i];
-    sum2 += buf2[i];
+  // Copy the (sub-sample aligned) triggered window into the frame. Peak
+  // envelopes can't be interpolated, so they snap to the nearest column.
+  int32_t start = (action == TRIG_SHOW) ? pos - ((int32_t)pre << 8) : 0;
+  if (f.peak) {
+    start = (start + 128) & ~0xFF;
+    triggerWindow(f.ch1Min, captureMin1, start, SAMPLES);
+    triggerWindow(f.ch1Max, captureMax1, start, SAMPLES);
+    triggerWindow(f.ch2Min, captureMin2, start, SAMPLES);
+    triggerWindow(f.ch2Max, captureMax2, start, SAMPLES);
   }
-  int16_t mid1 = (int16_t)(sum1 / SAMPLES);
-  int16_t mid2 = (int16_t)(sum2 / SAMPLES);
+  triggerWindow(f.ch1, captureBuf1, start, SAMPLES);
+  triggerWindow(f.ch2, captureBuf2, start, SAMPLES);
+  f.trig = cfg;
 
-  // 3. Draw ──────────────────────────────────────────────────
-  display.clearBuffer();
+  // Only triggered frames line up, free-run frames are shown as they are
+  if (f.mode == MODE_AVERAGE && action == TRIG_SHOW) {
+    averageFrame(f);
+  }
+  if (f.mode == MODE_ETS && action == TRIG_SHOW && !f.peak) {
+    etsFrame(f, pos, pre);
+  }
 
-  // Centre line (ground reference)
-  int midY = WAVEFORM_TOP + WAVEFORM_H / 2;
-  for (int x = 0; x < SCREEN_W; x += 4) {
-    display.drawPixel(x, midY); // dotted centre line
+  // Measurements over the whole capture: more periods than the screen
+  measure(f.meas, src, CAPTURE_LEN, cfg.level, cfg.hysteresis, sampleDelayUs);
+  f.triggered = (action == TRIG_SHOW);
+  f.holding = (cfg.mode == TRIG_SINGLE);
+
+  PROFILE_BEGIN(PROF_OFFSETS);
+  computeOffsets(f);
+  PROFILE_END(PROF_OFFSETS);
+  return true;
+}
+
+// Format millivolts as volts with two decimals ("-1.25").
+void formatVolts(char *out, size_t len, int32_t mv) {
+  const char *sign = (mv < 0) ? "-" : "";
+  if (mv < 0) {
+    mv = -mv;
   }
+  snprintf(out, len, "%s%ld.%02ld", sign, (long)(mv / 1000),
+           (long)((mv % 1000) / 10));
+}
 
-  // Waveforms
-  for (int x = 0; x < SAMPLES - 1; x++) {
-    int y1a = adcToY(buf1[x], vdiv_scale, mid1);
-    int y1b = adcToY(buf1[x + 1], vdiv_scale, mid1);
-    int y2a = adcToY(buf2[x], vdiv_scale, mid2);
-    int y2b = adcToY(buf2[x + 1], vdiv_scale, mid2);
+// Format a duration in microseconds as us/ms/s with 3–4 significant digits.
+void formatTime(char *out, size_t len, uint32_t us) {
+  if (us < 1000) {
+    snprintf(out, len, "%luus", (unsigned long)us);
+  } else if (us < 1000000) {
+    snprintf(out, len, "%lu.%02lums", (unsigned long)(us / 1000),
+             (unsigned long)(us % 1000 / 10));
+  } else {
+    snprintf(out, len, "%lu.%03lus", (unsigned long)(us / 1000000),
+             (unsigned long)(us % 1000000 / 1000));
+  }
+}
 
-    // CH1 — solid line
-    display.drawLine(x, y1a, x + 1, y1b);
+// Format a frequency in mHz as Hz/kHz with 3–4 significant digits.
+void formatFreq(char *out, size_t len, uint32_t mhz) {
+  if (mhz >= 1000000) {
+    snprintf(out, len, "%lu.%02lukHz", (unsigned long)(mhz / 1000000),
+             (unsigned long)((mhz % 1000000) / 10000));
+  } else if (mhz >= 100000) {
+    snprintf(out, len, "%lu.%luHz", (unsigned long)(mhz / 1000),
+             (unsigned long)((mhz % 1000) / 100));
+  } else {
+    snprintf(out, len, "%lu.%02luHz", (unsigned long)(mhz / 1000),
+             (unsigned long)((mhz % 1000) / 10));
+  }
+}
 
-    // CH2 — draw only on even pixels to visually distinguish channels
-    if (x % 2 == 0) {
-      display.drawPixel(x, y2a);
+// Clear the bottom bar and write a line of text into it.
+void drawBottomBar(const char *line) {
+  // Clear a strip behind the text so the trace doesn't run through it
+  display.setDrawColor(0);
+  display.drawBox(0, SCREEN_H - MEASURE_BAR_H, SCREEN_W, MEASURE_BAR_H);
+  display.setDrawColor(1);
+  display.drawStr(2, MEASURE_BAR_Y, line);
+}
+
+// Measurement bar at the bottom of the screen. Periodic signals show
+// frequency, Vpp, RMS and duty cycle; steady ones (CVs) the mean instead.
+void drawMeasurements(const Measurements &m) {
+  char vpp[12];
+  char rms[12];
+  formatVolts(vpp, sizeof(vpp), m.vppMv);
+  formatVolts(rms, sizeof(rms), m.rmsMv);
+
+  char line[64]; // every field at its widest; the bar shows ~32 characters
+  if (m.periodNs > 0) {
+    char freq[16];
+    formatFreq(freq, sizeof(freq), m.freqMilliHz);
+    snprintf(line, sizeof(line), "%s %sVpp %sVrms %u%%", freq, vpp, rms,
+             (m.dutyPermille + 5) / 10);
+  } else {
+    char mean[12];
+    formatVolts(mean, sizeof(mean), m.meanMv);
+    snprintf(line, sizeof(line), "DC %sV %sVpp %sVrms", mean, vpp, rms);
+  }
+  drawBottomBar(line);
+}
+
+// Map a channel to one Y pixel per column.
+void mapTrace(uint8_t *ys, const int16_t *samples, int16_t midADC) {
+  for (int x = 0; x < SAMPLES; x++) {
+    ys[x] = adcToY(samples[x], midADC);
+  }
+}
+
+// Segment bar at the bottom of the screen: time stamp of the shown segment
+// (or span of the burst when overlaid) and the longest re-arm dead time.
+void drawSegmentInfo(const SegmentInfo &s) {
+  char t[16];
+  char dead[16];
+  formatTime(t, sizeof(t), s.timeUs);
+  formatTime(dead, sizeof(dead), s.deadUs);
+
+  char line[48]; // every field at its widest
+  if (s.index == 0) {
+    snprintf(line, sizeof(line), "%u in %s dead %s", s.count, t, dead);
+  } else {
+    snprintf(line, sizeof(line), "+%s dead %s", t, dead);
+  }
+  drawBottomBar(line);
+}
+
+// Draw a peak-detect envelope: one vertical min→max span per column (every
+// `step` columns, starting at `first`). Spans are stretched to meet the
+// previous one so steep edges stay connected.
+void drawSpans(uint8_t *buf, const int16_t *mins, const int16_t *maxs,
+               int16_t midADC, int first, int step) {
+  int prevTop = -1;
+  int prevBot = -1;
+  for (int x = first; x < SAMPLES; x += step) {
+    int colTop = adcToY(maxs[x], midADC);
+    int colBot = adcToY(mins[x], midADC);
+    int top = colTop;
+    int bot = colBot;
+    if (prevTop >= 0) {
+      if (top > prevBot) {
+        top = prevBot;
+      }
+      if (bot < prevTop) {
+        bot = prevTop;
+      }
     }
+    rasterVSpan(buf, x, top, bot);
+    prevTop = colTop;
+    prevBot = colBot;
   }
+}
 
-  // CH1 / CH2 labels on left edge (font reused for status text)
+// Status bar: time/div on the left, `centre` in the middle and volts/div
+// on the right.
+void drawStatus(const Frame &f, const char *centre) {
   display.setFont(u8g2_font_4x6_tr);
 
-  // Status text: Time/Div on top-left, Volts/Div on top-right
-  char timeStr[12];
-  if (sampleDelayUs < 1000) {
-    snprintf(timeStr, sizeof(timeStr), "%luus", (unsigned long)sampleDelayUs);
+  char timeStr[16];
+  if (f.ets > 1) {
+    // Equivalent-time interval, below the ADC's: show it in ns or 0.1 us
+    uint32_t ns = f.intervalUs * 1000 / f.ets;
+    if (ns < 1000) {
+      snprintf(timeStr, sizeof(timeStr), "%luns", (unsigned long)ns);
+    } else {
+      snprintf(timeStr, sizeof(timeStr), "%lu.%luus",
+               (unsigned long)(ns / 1000), (unsigned long)(ns % 1000 / 100));
+    }
+  } else if (f.intervalUs < 1000) {
+    snprintf(timeStr, sizeof(timeStr), "%luus", (unsigned long)f.intervalUs);
   } else {
-    snprintf(timeStr, sizeof(timeStr), "%.1fms", sampleDelayUs / 1000.0f);
+    snprintf(timeStr, sizeof(timeStr), "%.1fms", f.intervalUs / 1000.0f);
   }
 
   char tLabel[16];
@@ -222,7 +844,7 @@ void loop() {
   display.drawStr(2, STATUS_Y, tLabel);
 
   // Compute and display actual Volts/Div instead of raw scale factor
-  float vpp = BASE_VPP_AT_VSCALE_1 * vdiv_scale;
+  float vpp = BASE_VPP_AT_VSCALE_1 * f.vdivScale;
   float vPerDiv = vpp / VERTICAL_DIVS;
 
   char vLabel[16];
@@ -233,8 +855,332 @@ void loop() {
   }
   display.drawStr(vX, STATUS_Y, vLabel);
 
+  display.drawStr((SCREEN_W - display.getStrWidth(centre)) / 2, STATUS_Y,
+                  centre);
+}
+
+// Draw a spectrum frame: one bar per bin, FFT_DB_RANGE dB tall, with the
+// bin width, range and peak readout in the status bars (core0).
+void drawSpectrum(const Frame &f) {
+  const Spectrum &sp = f.spectrum;
+  uint8_t *buf = display.getBufferPtr();
+
+  const int bottom = SCREEN_H - MEASURE_BAR_H - 1;
+  const int height = bottom - WAVEFORM_TOP;
+  for (int x = 0; x < FFT_BINS && x < SCREEN_W; x++) {
+    int db = sp.db[x];
+    if (db >= FFT_DB_RANGE) {
+      continue;
+    }
+    int h = (FFT_DB_RANGE - db) * height / FFT_DB_RANGE;
+    rasterVSpan(buf, x, bottom - h, bottom);
+  }
+
+  // Status: bin width on the left, mode in the middle, range on the right
+  display.setFont(u8g2_font_4x6_tr);
+  char label[24];
+  formatFreq(label, sizeof(label), 1000000000ul / f.intervalUs / FFT_N);
+  display.drawStr(2, STATUS_Y, label);
+  display.drawStr((SCREEN_W - display.getStrWidth("FFT")) / 2, STATUS_Y,
+                  "FFT");
+  snprintf(label, sizeof(label), "%ddB", FFT_DB_RANGE);
+  display.drawStr(SCREEN_W - display.getStrWidth(label) - 2, STATUS_Y, label);
+
+  char line[40];
+  if (sp.peakBin > 0) {
+    char freq[16];
+    formatFreq(freq, sizeof(freq), sp.peakMilliHz);
+    snprintf(line, sizeof(line), "PEAK %s -%udB", freq, sp.peakDb);
+  } else {
+    snprintf(line, sizeof(line), "PEAK --");
+  }
+  drawBottomBar(line);
+}
+
+// XY mode: CH1 deflects horizontally, CH2 vertically, both at the same
+// volts/div through the Y table, so the plot is a square centred on the
+// waveform area. Consecutive samples are joined (core0).
+void drawXY(const Frame &f) {
+  ymapSetScale(ymap, f.vdivScale);
+  uint8_t *buf = display.getBufferPtr();
+
+  // Dotted cross through the centre
+  const int midX = SCREEN_W / 2;
+  const int midY = WAVEFORM_TOP + WAVEFORM_H / 2;
+  rasterHDots(buf, midY, 4);
+  for (int y = WAVEFORM_TOP; y < WAVEFORM_TOP + WAVEFORM_H; y += 4) {
+    rasterPixel(buf, midX, y);
+  }
+
+  int prevX = -1;
+  int prevY = -1;
+  for (int i = f.firstX; i < SAMPLES; i++) {
+    int x = midX + midY - ymapLookup(ymap, f.ch1[i], f.mid1);
+    int y = ymapLookup(ymap, f.ch2[i], f.mid2);
+    if (prevX >= 0) {
+      display.drawLine(prevX, prevY, x, y);
+    }
+    prevX = x;
+    prevY = y;
+  }
+
+  drawStatus(f, "XY");
+  drawMeasurements(f.meas);
+}
+
+// Fold the freshly drawn waveform area into the persistence buffer and
+// replace it with the dithered intensities (core0).
+void applyPersistence(const Frame &f, uint8_t *buf) {
+  if (!persisting || f.intervalUs != persistIntervalUs ||
+      f.vdivScale != persistScale) {
+    persistClear(persistence);
+    persistIntervalUs = f.intervalUs;
+    persistScale = f.vdivScale;
+    persisting = true;
+  }
+  persistApply(persistence, buf);
+}
+
+// Draw one frame into the display buffer (core0).
+void drawFrame(const Frame &f) {
+  display.clearBuffer();
+  if (f.mode != MODE_PERSIST) {
+    persisting = false;
+  }
+  if (f.mode == MODE_FFT) {
+    drawSpectrum(f);
+    return;
+  }
+  if (f.mode == MODE_XY) {
+    drawXY(f);
+    return;
+  }
+
+  ymapSetScale(ymap, f.vdivScale);
+
+  // Traces are rasterized straight into U8g2's page buffer (see raster.h)
+  uint8_t *buf = display.getBufferPtr();
+
+  // Centre line (ground reference)
+  int midY = WAVEFORM_TOP + WAVEFORM_H / 2;
+  rasterHDots(buf, midY, 4); // dotted centre line
+
+  // Waveforms
+  if (f.peak) {
+    drawSpans(buf, f.ch1Min, f.ch1Max, f.mid1, f.firstX, 1); // CH1
+    drawSpans(buf, f.ch2Min, f.ch2Max, f.mid2, f.firstX, 2); // CH2
+  } else {
+    uint8_t ys[SAMPLES];
+
+    // CH1 — solid line
+    mapTrace(ys, f.ch1, f.mid1);
+    rasterSolid(buf, ys, SAMPLES);
+
+    // CH2 — draw only on even pixels to visually distinguish channels
+    mapTrace(ys, f.ch2, f.mid2);
+    rasterDotted(buf, ys, SAMPLES, 2);
+  }
+
+  // Trigger markers: position tick on top, level tick on the left edge
+  if (f.triggered) {
+    int trigX = (SAMPLES * f.trig.preTrigger) >> 8;
+    rasterVSpan(buf, trigX, WAVEFORM_TOP, WAVEFORM_TOP + 2);
+  }
+  int16_t trigMid = (f.trig.source == 0) ? f.mid1 : f.mid2;
+  int trigY = adcToY(f.trig.level, trigMid);
+  for (int x = 0; x < 3; x++) {
+    rasterPixel(buf, x, trigY);
+  }
+  if (f.levelAdjust) {
+    rasterHDots(buf, trigY, 2); // level being set: across the screen
+  }
+
+  if (f.mode == MODE_PERSIST) {
+    applyPersistence(f, buf);
+  }
+
+  // Trigger status in the middle: mode, slope and source (e.g. "AUTO R1")
+  // plus the display mode when it isn't the plain scope
+  static const char *const modeNames[] = {"AUTO", "NORM", "SNGL"};
+  const char *suffix = (f.mode == MODE_AVERAGE)   ? " AVG"
+                       : (f.mode == MODE_PERSIST) ? " PST"
+                       : (f.mode == MODE_ETS)     ? " ETS"
+                                                  : "";
+  char trigLabel[20]; // "SEG 255/255 R256" at the widest
+  if (f.mode == MODE_SEGMENT) {
+    // Segment shown (or ALL) of the burst, plus slope and source
+    char seg[8];
+    if (f.seg.index == 0) {
+      snprintf(seg, sizeof(seg), "ALL");
+    } else {
+      snprintf(seg, sizeof(seg), "%u/%u", f.seg.index, f.seg.count);
+    }
+    snprintf(trigLabel, sizeof(trigLabel), "SEG %s %c%d", seg,
+             f.trig.slope == TRIG_RISING ? 'R' : 'F', f.trig.source + 1);
+  } else if (f.rolling) {
+    snprintf(trigLabel, sizeof(trigLabel), "ROLL%s", suffix);
+  } else if (f.holding) {
+    snprintf(trigLabel, sizeof(trigLabel), "STOP%s", suffix);
+  } else {
+    snprintf(trigLabel, sizeof(trigLabel), "%s %c%d%s",
+             modeNames[f.trig.mode], f.trig.slope == TRIG_RISING ? 'R' : 'F',
+             f.trig.source + 1, suffix);
+  }
+  drawStatus(f, trigLabel);
+
+  if (f.mode == MODE_SEGMENT) {
+    drawSegmentInfo(f.seg);
+  } else {
+    drawMeasurements(f.meas);
+  }
+}
+
+#if PROFILE_ENABLED
+// Profiling overlay: min/avg/max microseconds of every stage over the last
+// PROFILE_FRAMES frames, over the top left of the waveform area (core0).
+void drawProfile() {
+  const int lineH = 6;
+  const int w = 4 * 20 + 2;
+  const int h = lineH * (PROF_STAGES + 1) + 1;
+  display.setDrawColor(0);
+  display.drawBox(0, WAVEFORM_TOP, w, h);
+  display.setDrawColor(1);
+  display.setFont(u8g2_font_4x6_tr);
+
+  int y = WAVEFORM_TOP + lineH - 1;
+  display.drawStr(1, y, "us     min  avg  max");
+  for (int i = 0; i < PROF_STAGES; i++) {
+    ProfileStats st;
+    profileStats((ProfileStage)i, st);
+    char line[40];
+    snprintf(line, sizeof(line), "%-4.4s %5lu%5lu%5lu",
+             profileName((ProfileStage)i), (unsigned long)st.minUs,
+             (unsigned long)st.avgUs, (unsigned long)st.maxUs);
+    y += lineH;
+    display.drawStr(1, y, line);
+  }
+}
+
+#if !STREAM_SERIAL
+// Print the same summary over USB serial. Not while streaming: core1
+// writes binary frames to the same port, and text from core0 could land
+// in the middle of one.
+void printProfile() {
+  for (int i = 0; i < PROF_STAGES; i++) {
+    ProfileStats st;
+    profileStats((ProfileStage)i, st);
+    Serial.printf("%s min %lu avg %lu max %lu us%s",
+                  profileName((ProfileStage)i), (unsigned long)st.minUs,
+                  (unsigned long)st.avgUs, (unsigned long)st.maxUs,
+                  (i + 1 < PROF_STAGES) ? ", " : "\n");
+  }
+}
+#endif
+#endif
+
+// Send the changed tiles of the display buffer and update the frame-rate
+// counter (core0).
+void sendDirty() {
+  DirtySpan spans[DISPLAY_PAGES];
+  displayBytes += dirtyScan(dirty, display.getBufferPtr(), spans);
+  for (int p = 0; p < DISPLAY_PAGES; p++) {
+    if (spans[p].tw > 0) {
+      display.updateDisplayArea(spans[p].tx, p, spans[p].tw, 1);
+    }
+  }
+
+  displayFrames++;
+  uint32_t now = millis();
+  if (now - displayStatsMs >= 1000) {
+    displayFps = displayFrames * 1000 / (now - displayStatsMs);
+    displayBytesPerFrame = displayFrames ? displayBytes / displayFrames : 0;
+    displayFrames = 0;
+    displayBytes = 0;
+    displayStatsMs = now;
+#if DISPLAY_STATS_SERIAL
+    Serial.printf("fps %u, %lu bytes/frame, %lu dropped\n", displayFps,
+                  (unsigned long)displayBytesPerFrame,
+                  (unsigned long)frames.dropped());
+#endif
+#if PROFILE_ENABLED && !STREAM_SERIAL
+    printProfile();
+#endif
+  }
+}
+
+// ── Setup ────────────────────────────────────────────────────
+void setup() {
+  ymapInit(ymap);
+  dirtyInit(dirty);
+#if DISPLAY_STATS_SERIAL || STREAM_SERIAL || PROFILE_ENABLED
+  Serial.begin(115200);
+#endif
+
+  display.begin();
+  display.setFont(u8g2_font_4x6_tr); // tiny font for status bar
+  display.setDrawColor(1);
+
+  // Brief splash (centered)
+  display.clearBuffer();
+
+  const char *title = "PICO SCOPE";
+  display.setFont(u8g2_font_6x10_tr);
+  int titleW = display.getStrWidth(title);
+  int titleX = (SCREEN_W - titleW) / 2;
+  int titleY = (SCREEN_H / 2) - 2;
+  display.drawStr(titleX, titleY, title);
+
+  display.setFont(u8g2_font_4x6_tr);
+  int verW = display.getStrWidth(VERSION);
+  int verX = (SCREEN_W - verW) / 2;
+  int verY = titleY + 10;
+  display.drawStr(verX, verY, VERSION);
+
   display.sendBuffer();
+  delay(2000);
+}
 
-  // 4. No fixed delay — loop rate is determined by capture time
+void setup1() {
+  pinMode(PIN_TRIG_BTN, INPUT_PULLUP);
+  pinMode(PIN_MODE_BTN, INPUT_PULLUP);
+  analogReadResolution(12); // Pico supports 12-bit ADC
+  analogRead(PIN_TIMEDIV);  // let the core initialise the ADC first
+  captureBegin();
 }
 
+// ── Main loop (core0: render) ────────────────────────────────
+void loop() {
+  const Frame *f = frames.acquire();
+  if (f == nullptr) {
+    return; // core1 hasn't finished the next frame yet
+  }
+
+  PROFILE_BEGIN(PROF_DRAW);
+  drawFrame(*f);
+#if PROFILE_ENABLED
+  if (f->profile) {
+    drawProfile();
+  }
+#endif
+  PROFILE_END(PROF_DRAW);
+
+  // The display buffer now holds everything we need: hand the frame back
+  // before the blocking transfer so core1 can publish the next one.
+  frames.release();
+  PROFILE_BEGIN(PROF_SEND);
+  sendDirty();
+  PROFILE_END(PROF_SEND);
+}
+
+// ── Capture loop (core1) ─────────────────────────────────────
+void loop1() {
+  pollButtons();
+
+  if (trigCfg.mode == TRIG_SINGLE && !trigState.armed &&
+      displayMode != MODE_SEGMENT) {
+    return; // single shot done, hold the last frame
+  }
+  if (acquireFrame(*frames.back())) {
+    frames.publish();
+  }
+}
@@ -0,0 +1,179 @@
+"""Read the pico_scope USB waveform stream and save it as CSV, WAV or raw.
+
+    python stream_reader.py /dev/ttyACM0 capture.csv
+    python stream_reader.py /dev/ttyACM0 capture.wav --frames 200
+    python stream_reader.py /dev/ttyACM0 dump.bin --frames 500
+
+The input can also be a file holding a raw dump of the stream. A .bin
+output is one: the intact frames, byte for byte, as the scope sent them.
+Prefer it to `cat /dev/ttyACM0`, which only works on a port set to raw
+mode first (`stty -F /dev/ttyACM0 raw -echo`); in the default mode the
+terminal driver rewrites the binary data. See lib/scope_core/src/stream.h
+for the frame format.
+"""
+import argparse
+import struct
+import sys
+import wave
+
+# === Protocol (keep in sync with stream.h) ===
+MAGIC = b"PSCP"
+VERSION = 1
+HEADER = struct.Struct("<4sBBHIIIHH")  # 24 bytes
+NO_TRIGGER = 0xFFFF
+
+# === Calibration (keep in sync with config.h) ===
+ADC_MID = 2048
+ADC_MAX = 4095
+BASE_VPP_AT_VSCALE_1 = 10.0
+VOLTS_PER_CODE = BASE_VPP_AT_VSCALE_1 / (2 * (ADC_MAX // 2))
+
+
+def fletcher16(data, a=0, b=0):
+    for byte in data:
+        a = (a + byte) % 255
+        b = (b + a) % 255
+    return a, b
+
+
+def read_frames(stream, live=False):
+    """Yield (header dict, samples per channel) for every valid frame.
+
+    Resynchronises on the magic, so it can start mid-stream and skips
+    frames with a bad checksum (reported on stderr).
+    """
+    buf = b""
+    while True:
+        chunk = stream.read(4096)
+        if not chunk:
+            if live:
+                continue  # serial read timed out, keep waiting
+            return
+        buf += chunk
+        while True:
+            start = buf.find(MAGIC)
+            if start < 0:
+                buf = buf[-(len(MAGIC) - 1):]
+                break
+            buf = buf[start:]
+            if len(buf) < HEADER.size:
+                break
+            (_, version, channels, count, seq, time_us, interval_ns,
+             trig_index, _) = HEADER.unpack_from(buf)
+            if version != VERSION or channels == 0:
+                buf = buf[1:]
+                continue
+            payload = 2 * channels * count
+            size = HEADER.size + payload + 2
+            if len(buf) < size:
+                break
+            frame, buf = buf[:size], buf[size:]
+
+            a, b = fletcher16(frame[:-2])
+            (check,) = struct.unpack_from("<H", frame, size - 2)
+            if check != (b << 8 | a):
+                print(f"frame {seq}: bad checksum, dropped", file=sys.stderr)
+                continue
+
+            raw = struct.unpack_from(f"<{channels * count}H", frame,
+                                     HEADER.size)
+            samples = [raw[c::channels] for c in range(channels)]
+            header = {
+                "seq": seq,
+                "time_us": time_us,
+                "interval_ns": interval_ns,
+                "trigger": None if trig_index == NO_TRIGGER else trig_index,
+                "frame": frame,
+            }
+            yield header, samples
+
+
+def to_volts(code):
+    # The input stage is inverting: higher codes are lower voltages
+    return (ADC_MID - code) * VOLTS_PER_CODE
+
+
+def write_csv(frames, path):
+    with open(path, "w") as f:
+        f.write("seq,time_us,index,trigger,ch1_v,ch2_v\n")
+        n = 0
+        for header, samples in frames:
+            t0 = header["time_us"]
+            step_us = header["interval_ns"] / 1000.0
+            count = len(samples[0])
+            for i in range(count):
+                # time_us stamps the end of the capture
+                t = t0 - (count - 1 - i) * step_us
+                volts = [to_volts(ch[i]) for ch in samples]
+                trig = 1 if header["trigger"] == i else 0
+                f.write(f"{header['seq']},{t:.1f},{i},{trig},"
+                        + ",".join(f"{v:.4f}" for v in volts) + "\n")
+            n += 1
+    return n
+
+
+def write_wav(frames, path):
+    wf = None
+    n = 0
+    try:
+        for header, samples in frames:
+            if wf is None:
+                rate = round(1e9 / header["interval_ns"])
+                wf = wave.open(path, "wb")
+                wf.setnchannels(len(samples))
+                wf.setsampwidth(2)
+                wf.setframerate(rate)
+            # 12-bit codes around ADC_MID → signed 16-bit, polarity restored
+            data = bytearray()
+            for i in range(len(samples[0])):
+                for ch in samples:
+                    data += struct.pack("<h", (ADC_MID - ch[i]) * 16)
+            wf.writeframes(bytes(data))
+            n += 1
+    finally:
+        if wf is not None:
+            wf.close()
+    return n
+
+
+def write_raw(frames, path):
+    with open(path, "wb") as f:
+        n = 0
+        for header, _ in frames:
+            f.write(header["frame"])
+            n += 1
+    return n
+
+
+def open_input(name):
+    """Return (stream, live): a serial port if `name` is one, else a file."""
+    try:
+        import serial  # pyserial, only needed for live capture
+        return serial.Serial(name, timeout=1), True
+    except (ImportError, ValueError, OSError):
+        return open(name, "rb"), False
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", help="serial port or raw dump file")
+    parser.add_argument("output", help="output .csv, .wav or .bin (raw)")
+    parser.add_argument("--frames", type=int, default=0,
+                        help="stop after this many frames (0 = until EOF)")
+    args = parser.parse_args()
+
+    frames = read_frames(*open_input(args.input))
+    if args.frames > 0:
+        frames = (fr for _, fr in zip(range(args.frames), frames))
+
+    if args.output.lower().endswith(".wav"):
+        n = write_wav(frames, args.output)
+    elif args.output.lower().endswith(".bin"):
+        n = write_raw(frames, args.output)
+    else:
+        n = write_csv(frames, args.output)
+    print(f"{n} frames written to {args.output}")
+
+
+if __name__ == "__main__":
+    main()